@@ -39,17 +39,17 @@ nyx_dict_t *nyx_blob_prop_new(STR_t name, STR_t label, STR_t format, size_t size
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defBLOB", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defBLOB", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
-    nyx_dict_set_string_unref(result, "@format", nyx_string_dup(format), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(FORMAT), nyx_string_dup(format), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_buff_unref(result, "$", size, buff, managed);
+    nyx_dict_set_buff_unref(result, NYX_ATOM(CONTENT), size, buff, managed);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -70,14 +70,14 @@ bool nyx_blob_prop_set(const nyx_dict_t *prop, size_t size, BUFF_t buff, bool ma
         managed = false;
     }
 
-    return nyx_dict_set_buff(prop, "$", size, buff, managed);
+    return nyx_dict_set_buff(prop, NYX_ATOM(CONTENT), size, buff, managed);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 void nyx_blob_prop_get(const nyx_dict_t *prop, size_t *size, buff_t *buff)
 {
-    return nyx_dict_get_buff(prop, "$", size, buff);
+    return nyx_dict_get_buff(prop, NYX_ATOM(CONTENT), size, buff);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -98,16 +98,18 @@ nyx_dict_t *nyx_blob_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defBLOBVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defBLOBVector", false);
+
+    result->kind = NYX_VECTOR_KIND_BLOB;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
-    nyx_dict_set_string_unref(result, "@perm", nyx_perm_to_str(perm), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(PERM), nyx_perm_to_str(perm), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -115,7 +117,7 @@ nyx_dict_t *nyx_blob_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
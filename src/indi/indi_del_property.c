@@ -24,22 +24,22 @@ nyx_dict_t *nyx_del_property_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "delProperty", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "delProperty", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@timestamp", nyx_string_dup(timestamp), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TIMESTAMP), nyx_string_dup(timestamp), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     if(name != NULL) {
-        nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+        nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
     }
 
     if(message != NULL) {
-        nyx_dict_set_string_unref(result, "@message", nyx_string_dup(message), true);
+        nyx_dict_set_string_unref(result, NYX_ATOM(MESSAGE), nyx_string_dup(message), true);
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -26,16 +26,16 @@ nyx_dict_t *nyx_light_prop_new(STR_t name, STR_t label, nyx_state_t value)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defLight", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defLight", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "$", nyx_state_to_str(value), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), nyx_state_to_str(value), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -48,14 +48,14 @@ nyx_dict_t *nyx_light_prop_new(STR_t name, STR_t label, nyx_state_t value)
 
 bool nyx_light_prop_set(const nyx_dict_t *prop, nyx_state_t value)
 {
-    return nyx_dict_set_string(prop, "$", nyx_state_to_str(value), false);
+    return nyx_dict_set_string(prop, NYX_ATOM(CONTENT), nyx_state_to_str(value), false);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 nyx_state_t nyx_light_prop_get(const nyx_dict_t *prop)
 {
-    return nyx_str_to_state(nyx_dict_get_string(prop, "$"));
+    return nyx_str_to_state(nyx_dict_get_string(prop, NYX_ATOM(CONTENT)));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -75,15 +75,17 @@ nyx_dict_t *nyx_light_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defLightVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defLightVector", false);
+
+    result->kind = NYX_VECTOR_KIND_LIGHT;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -91,7 +93,7 @@ nyx_dict_t *nyx_light_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
@@ -28,14 +28,14 @@ nyx_dict_t *nyx_message_new(STR_t device, STR_t message)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "message", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "message", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@message", nyx_string_dup(message), true);
-    nyx_dict_set_string_unref(result, "@timestamp", nyx_string_dup(timestamp), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(MESSAGE), nyx_string_dup(message), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TIMESTAMP), nyx_string_dup(timestamp), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
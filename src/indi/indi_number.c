@@ -26,21 +26,21 @@ static nyx_dict_t *_prop_new(STR_t name, STR_t label, STR_t format, nyx_variant_
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defNumber", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defNumber", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
-    nyx_dict_set_string_unref(result, "@format", nyx_string_dup(format), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(FORMAT), nyx_string_dup(format), true);
 
-    nyx_dict_set_string_unref(result, "@min", internal_variant_to_string(format, min), true);
-    nyx_dict_set_string_unref(result, "@max", internal_variant_to_string(format, max), true);
-    nyx_dict_set_string_unref(result, "@step", internal_variant_to_string(format, step), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(MIN), internal_variant_to_string(format, min), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(MAX), internal_variant_to_string(format, max), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STEP), internal_variant_to_string(format, step), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "$", internal_variant_to_string(format, value), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), internal_variant_to_string(format, value), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -80,9 +80,9 @@ nyx_dict_t *nyx_number_prop_new_double(STR_t name, STR_t label, STR_t format, do
 
 static bool _prop_set(const nyx_dict_t *prop, nyx_variant_t value)
 {
-    STR_t format = nyx_dict_get_string(prop, "@format");
+    STR_t format = nyx_dict_get_string(prop, NYX_ATOM(FORMAT));
 
-    return nyx_dict_set_string(prop, "$", internal_variant_to_string(format, value), true);
+    return nyx_dict_set_string(prop, NYX_ATOM(CONTENT), internal_variant_to_string(format, value), true);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -116,9 +116,9 @@ bool nyx_number_prop_set_double(nyx_dict_t *prop, double value)
 
 static nyx_variant_t _prop_get(const nyx_dict_t *prop)
 {
-    STR_t format = nyx_dict_get_string(prop, "@format");
+    STR_t format = nyx_dict_get_string(prop, NYX_ATOM(FORMAT));
 
-    return internal_string_to_variant(format, nyx_dict_get_string(prop, "$"));
+    return internal_string_to_variant(format, nyx_dict_get_string(prop, NYX_ATOM(CONTENT)));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -166,16 +166,18 @@ nyx_dict_t *nyx_number_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defNumberVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defNumberVector", false);
+
+    result->kind = NYX_VECTOR_KIND_NUMBER;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
-    nyx_dict_set_string_unref(result, "@perm", nyx_perm_to_str(perm), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(PERM), nyx_perm_to_str(perm), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -183,7 +185,7 @@ nyx_dict_t *nyx_number_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
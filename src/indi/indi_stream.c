@@ -37,13 +37,13 @@ nyx_dict_t *nyx_stream_prop_new(STR_t name, STR_t label)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defStream", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defStream", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@hash", nyx_string_dup(hash), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(HASH), nyx_string_dup(hash), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -67,15 +67,17 @@ nyx_dict_t *nyx_stream_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defStreamVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defStreamVector", false);
+
+    result->kind = NYX_VECTOR_KIND_STREAM;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -83,7 +85,7 @@ nyx_dict_t *nyx_stream_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
@@ -123,14 +125,21 @@ bool nyx_stream_pub(const nyx_dict_t *vector, size_t n_fields, const size_t fiel
         return true;
     }
 
+    if(n_fields > NYX_STREAM_MAX_FIELDS)
+    {
+        NYX_LOG_ERROR("Too many stream fields, %d at most", NYX_STREAM_MAX_FIELDS);
+
+        return false;
+    }
+
     /*----------------------------------------------------------------------------------------------------------------*/
     /* RETRIEVE INFORMATION                                                                                           */
     /*----------------------------------------------------------------------------------------------------------------*/
 
     const nyx_node_t *node = vector->base.node;
 
-    STR_t device = nyx_dict_get_string(vector, "@device");
-    STR_t stream = nyx_dict_get_string(vector,  "@name" );
+    STR_t device = nyx_dict_get_string(vector, NYX_ATOM(DEVICE));
+    STR_t stream = nyx_dict_get_string(vector,  NYX_ATOM(NAME) );
 
     if(node == NULL || device == NULL || stream == NULL)
     {
@@ -147,14 +156,14 @@ bool nyx_stream_pub(const nyx_dict_t *vector, size_t n_fields, const size_t fiel
 
     nyx_object_t *dict;
 
-    uint32_t prepd_hashes[n_fields];
+    uint32_t prepd_hashes[NYX_STREAM_MAX_FIELDS];
 
-    size_t prepd_sizes[n_fields];
-    BUFF_t prepd_buffs[n_fields];
+    size_t prepd_sizes[NYX_STREAM_MAX_FIELDS];
+    BUFF_t prepd_buffs[NYX_STREAM_MAX_FIELDS];
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_object_t *list = nyx_dict_get(vector, "children");
+    nyx_object_t *list = nyx_dict_get(vector, NYX_ATOM(CHILDREN));
 
     if(list != NULL && list->type == NYX_TYPE_LIST)
     {
@@ -164,7 +173,7 @@ bool nyx_stream_pub(const nyx_dict_t *vector, size_t n_fields, const size_t fiel
         {
             if(dict->type == NYX_TYPE_DICT && idx < n_fields)
             {
-                nyx_object_t *string = nyx_dict_get((nyx_dict_t *) dict, "@name");
+                nyx_object_t *string = nyx_dict_get((nyx_dict_t *) dict, NYX_ATOM(NAME));
 
                 if(string != NULL && string->type == NYX_TYPE_STRING)
                 {
@@ -250,7 +259,7 @@ bool nyx_stream_pub(const nyx_dict_t *vector, size_t n_fields, const size_t fiel
     /* PUBLISH STREAM                                                                                                 */
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_nss_pub(node, device, stream, n_fields, prepd_hashes, prepd_sizes, prepd_buffs);
+    bool result = nyx_nss_pub(node, device, stream, n_fields, prepd_hashes, prepd_sizes, prepd_buffs);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -264,7 +273,7 @@ bool nyx_stream_pub(const nyx_dict_t *vector, size_t n_fields, const size_t fiel
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    return true;
+    return result;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
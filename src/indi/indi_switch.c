@@ -26,16 +26,16 @@ nyx_dict_t *nyx_switch_prop_new(STR_t name, STR_t label, nyx_onoff_t value)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defSwitch", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defSwitch", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "$", nyx_onoff_to_str(value), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), nyx_onoff_to_str(value), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -48,14 +48,14 @@ nyx_dict_t *nyx_switch_prop_new(STR_t name, STR_t label, nyx_onoff_t value)
 
 bool nyx_switch_prop_set(const nyx_dict_t *prop, nyx_onoff_t value)
 {
-    return nyx_dict_set_string(prop, "$", nyx_onoff_to_str(value), false);
+    return nyx_dict_set_string(prop, NYX_ATOM(CONTENT), nyx_onoff_to_str(value), false);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 nyx_onoff_t nyx_switch_prop_get(const nyx_dict_t *prop)
 {
-    return nyx_str_to_onoff(nyx_dict_get_string(prop, "$"));
+    return nyx_str_to_onoff(nyx_dict_get_string(prop, NYX_ATOM(CONTENT)));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -77,17 +77,19 @@ nyx_dict_t *nyx_switch_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defSwitchVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defSwitchVector", false);
+
+    result->kind = NYX_VECTOR_KIND_SWITCH;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
-    nyx_dict_set_string_unref(result, "@perm", nyx_perm_to_str(perm), false);
-    nyx_dict_set_string_unref(result, "@rule", nyx_rule_to_str(rule), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(PERM), nyx_perm_to_str(perm), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(RULE), nyx_rule_to_str(rule), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -95,7 +97,7 @@ nyx_dict_t *nyx_switch_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
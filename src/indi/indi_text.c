@@ -33,16 +33,16 @@ nyx_dict_t *nyx_text_prop_new(STR_t name, STR_t label, STR_t value, bool managed
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defText", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defText", false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
-    nyx_dict_set_string_unref(result, "@label", nyx_string_dup(label), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(LABEL), nyx_string_dup(label), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "$", value, managed);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), value, managed);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -62,14 +62,14 @@ bool nyx_text_prop_set(const nyx_dict_t *prop, STR_t value, bool managed)
         managed = false;
     }
 
-    return nyx_dict_set_string(prop, "$", nyx_string_dup(value), managed);
+    return nyx_dict_set_string(prop, NYX_ATOM(CONTENT), nyx_string_dup(value), managed);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 STR_t nyx_text_prop_get(const nyx_dict_t *prop)
 {
-    return nyx_dict_get_string(prop, "$");
+    return nyx_dict_get_string(prop, NYX_ATOM(CONTENT));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -90,16 +90,18 @@ nyx_dict_t *nyx_text_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", "defTextVector", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), "defTextVector", false);
+
+    result->kind = NYX_VECTOR_KIND_TEXT;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "@client", "unknown", false);
-    nyx_dict_set_string_unref(result, "@device", nyx_string_dup(device), true);
-    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(CLIENT), "unknown", false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(DEVICE), nyx_string_dup(device), true);
+    nyx_dict_set_string_unref(result, NYX_ATOM(NAME), nyx_string_dup(name), true);
 
-    nyx_dict_set_string_unref(result, "@state", nyx_state_to_str(state), false);
-    nyx_dict_set_string_unref(result, "@perm", nyx_perm_to_str(perm), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(STATE), nyx_state_to_str(state), false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(PERM), nyx_perm_to_str(perm), false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -107,7 +109,7 @@ nyx_dict_t *nyx_text_vector_new(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     if(props) for(; *props != NULL; props++)
     {
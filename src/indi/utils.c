@@ -356,7 +356,7 @@ void internal_set_opts(nyx_dict_t *dict, const nyx_opts_t *opts)
 
     internal_get_timestamp(sizeof(timestamp), timestamp);
 
-    nyx_dict_set_string_unref(dict, "@timestamp", nyx_string_dup(timestamp), true);
+    nyx_dict_set_string_unref(dict, NYX_ATOM(TIMESTAMP), nyx_string_dup(timestamp), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -374,21 +374,21 @@ void internal_set_opts(nyx_dict_t *dict, const nyx_opts_t *opts)
         /*------------------------------------------------------------------------------------------------------------*/
 
         if(opts->label != NULL && opts->label[0] != '\0') {
-            nyx_dict_set_string_unref(dict, "@label", nyx_string_dup(opts->label), true);
+            nyx_dict_set_string_unref(dict, NYX_ATOM(LABEL), nyx_string_dup(opts->label), true);
         }
 
         if(opts->hints != NULL && opts->hints[0] != '\0') {
-            nyx_dict_set_string_unref(dict, "@hints", nyx_string_dup(opts->hints), true);
+            nyx_dict_set_string_unref(dict, NYX_ATOM(HINTS), nyx_string_dup(opts->hints), true);
         }
 
         if(opts->message != NULL && opts->message[0] != '\0') {
-            nyx_dict_set_string_unref(dict, "@message", nyx_string_dup(opts->message), true);
+            nyx_dict_set_string_unref(dict, NYX_ATOM(MESSAGE), nyx_string_dup(opts->message), true);
         }
 
         /*------------------------------------------------------------------------------------------------------------*/
 
         if(opts->timeout > 0.0) {
-            nyx_dict_set_number_unref(dict, "@timeout", opts->timeout);
+            nyx_dict_set_number_unref(dict, NYX_ATOM(TIMEOUT), opts->timeout);
         }
 
         /*------------------------------------------------------------------------------------------------------------*/
@@ -396,7 +396,7 @@ void internal_set_opts(nyx_dict_t *dict, const nyx_opts_t *opts)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(dict, "@group", nyx_string_dup(group), true);
+    nyx_dict_set_string_unref(dict, NYX_ATOM(GROUP), nyx_string_dup(group), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 }
@@ -405,7 +405,7 @@ void internal_set_opts(nyx_dict_t *dict, const nyx_opts_t *opts)
 
 bool internal_blob_is_compressed(const nyx_dict_t *def)
 {
-    nyx_string_t *format = (nyx_string_t *) /* NOSONAR */ nyx_dict_get(def, "@format");
+    nyx_string_t *format = (nyx_string_t *) /* NOSONAR */ nyx_dict_get(def, NYX_ATOM(FORMAT));
 
     return format != NULL && format->base.type == NYX_TYPE_STRING && format->length > 2 && format->value[format->length - 2] == '.' && format->value[format->length - 1] == 'z';
 }
@@ -416,12 +416,12 @@ static void internal_copy_blob(nyx_dict_t *dst_dict, const nyx_dict_t *src_dict)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    internal_copy(dst_dict, src_dict, "@size");
-    internal_copy(dst_dict, src_dict, "@format");
+    internal_copy(dst_dict, src_dict, NYX_ATOM(SIZE));
+    internal_copy(dst_dict, src_dict, NYX_ATOM(FORMAT));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_object_t *src_payload = nyx_dict_get(src_dict, "$");
+    nyx_object_t *src_payload = nyx_dict_get(src_dict, NYX_ATOM(CONTENT));
 
     if(src_payload != NULL && src_payload->type == NYX_TYPE_STRING)
     {
@@ -446,7 +446,7 @@ static void internal_copy_blob(nyx_dict_t *dst_dict, const nyx_dict_t *src_dict)
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        nyx_dict_set(dst_dict, "$", nyx_string_from_buff(dst_len, dst_str, true));
+        nyx_dict_set(dst_dict, NYX_ATOM(CONTENT), nyx_string_from_buff(dst_len, dst_str, true));
 
         /*------------------------------------------------------------------------------------------------------------*/
     }
@@ -466,21 +466,21 @@ nyx_dict_t *internal_prop_to_set_vector(const nyx_dict_t *vector, STR_t set_tag,
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set_string_unref(result, "<>", set_tag, false);
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), set_tag, false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    internal_copy(result, vector, "@client");
-    internal_copy(result, vector, "@device");
-    internal_copy(result, vector, "@name");
-    internal_copy(result, vector, "@state");
-    internal_copy(result, vector, "@timeout");
-    internal_copy(result, vector, "@timestamp");
-    internal_copy(result, vector, "@message");
+    internal_copy(result, vector, NYX_ATOM(CLIENT));
+    internal_copy(result, vector, NYX_ATOM(DEVICE));
+    internal_copy(result, vector, NYX_ATOM(NAME));
+    internal_copy(result, vector, NYX_ATOM(STATE));
+    internal_copy(result, vector, NYX_ATOM(TIMEOUT));
+    internal_copy(result, vector, NYX_ATOM(TIMESTAMP));
+    internal_copy(result, vector, NYX_ATOM(MESSAGE));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "children", children);
+    nyx_dict_set(result, NYX_ATOM(CHILDREN), children);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -488,7 +488,15 @@ nyx_dict_t *internal_prop_to_set_vector(const nyx_dict_t *vector, STR_t set_tag,
 
     nyx_object_t *object;
 
-    nyx_object_t *list = nyx_dict_get(vector, "children");
+    nyx_object_t *list = nyx_dict_get(vector, NYX_ATOM(CHILDREN));
+
+    /* Only the properties modified since the previous setXXXVector are sent, except for the switches of */
+    /* OneOfMany and AtMostOne vectors which are always sent together. The node clears the dirty flags   */
+    /* once the vector is published, building a setXXXVector has no side effect.                        */
+
+    STR_t rule = nyx_dict_get_string(vector, NYX_ATOM(RULE));
+
+    bool delta = strcmp(one_tag, "oneSwitch") != 0 || (rule != NULL && strcmp(rule, "AnyOfMany") == 0);
 
     if(list != NULL && list->type == NYX_TYPE_LIST)
     {
@@ -498,19 +506,28 @@ nyx_dict_t *internal_prop_to_set_vector(const nyx_dict_t *vector, STR_t set_tag,
             {
                 /*----------------------------------------------------------------------------------------------------*/
 
+                bool dirty = (object->flags & NYX_FLAGS_DIRTY) != 0;
+
+                if(delta && !dirty)
+                {
+                    continue;
+                }
+
+                /*----------------------------------------------------------------------------------------------------*/
+
                 nyx_dict_t *src_dict = (nyx_dict_t *) /* NOSONAR */ object, *dst_dict = nyx_dict_new();
 
                 /*----------------------------------------------------------------------------------------------------*/
 
-                nyx_dict_set_string_unref(dst_dict, "<>", one_tag, false);
+                nyx_dict_set_string_unref(dst_dict, NYX_ATOM(TAG), one_tag, false);
 
-                internal_copy(dst_dict, src_dict, "@name");
+                internal_copy(dst_dict, src_dict, NYX_ATOM(NAME));
 
                 if(strcmp(one_tag, "oneBLOB") == 0) {
                     internal_copy_blob(dst_dict, src_dict);
                 }
                 else {
-                    internal_copy(dst_dict, src_dict, "$");
+                    internal_copy(dst_dict, src_dict, NYX_ATOM(CONTENT));
                 }
 
                 /*----------------------------------------------------------------------------------------------------*/
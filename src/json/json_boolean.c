@@ -13,12 +13,14 @@ nyx_boolean_t *nyx_boolean_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_boolean_t *object = nyx_memory_alloc(sizeof(nyx_boolean_t));
+    nyx_boolean_t *object = nyx_memory_pool_alloc(sizeof(nyx_boolean_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_BOOLEAN);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->value = false;
@@ -32,7 +34,7 @@ nyx_boolean_t *nyx_boolean_new(void)
 
 void nyx_boolean_free(nyx_boolean_t *object)
 {
-    nyx_memory_free(object);
+    nyx_memory_pool_free(object, sizeof(nyx_boolean_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -50,7 +52,7 @@ bool nyx_boolean_set(nyx_boolean_t *object, bool value)
     object->value != value;
     object->value = value;
 
-    return modified;
+    return internal_mark_dirty(object->base.parent, modified);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -5,6 +5,7 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "../nyx_node_internal.h"
@@ -15,23 +16,261 @@ static void internal_dict_clear(
     nyx_dict_t *object
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* ATOMS                                                                                                              */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Sorted for bsearch(), must follow the order of nyx_atom_t. */
+
+const char internal_atoms[NYX_ATOM_NB][NYX_ATOM_WIDTH] = {
+    [NYX_ATOM_CONTENT] = "$",
+    [NYX_ATOM_TAG] = "<>",
+    [NYX_ATOM_CLIENT] = "@client",
+    [NYX_ATOM_DEVICE] = "@device",
+    [NYX_ATOM_FORMAT] = "@format",
+    [NYX_ATOM_GROUP] = "@group",
+    [NYX_ATOM_HASH] = "@hash",
+    [NYX_ATOM_HINTS] = "@hints",
+    [NYX_ATOM_LABEL] = "@label",
+    [NYX_ATOM_MAX] = "@max",
+    [NYX_ATOM_MESSAGE] = "@message",
+    [NYX_ATOM_MIN] = "@min",
+    [NYX_ATOM_NAME] = "@name",
+    [NYX_ATOM_PERM] = "@perm",
+    [NYX_ATOM_RULE] = "@rule",
+    [NYX_ATOM_SIZE] = "@size",
+    [NYX_ATOM_STATE] = "@state",
+    [NYX_ATOM_STEP] = "@step",
+    [NYX_ATOM_TIMEOUT] = "@timeout",
+    [NYX_ATOM_TIMESTAMP] = "@timestamp",
+    [NYX_ATOM_CHILDREN] = "children",
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Integer arithmetic on addresses, pointers to unrelated objects are never compared. Only the start of an atom */
+/* matches, a pointer into the middle of one does not.                                                          */
+
+__NYX_INLINE__ bool internal_is_atom(STR_t key)
+{
+    uintptr_t offset = (uintptr_t) key - (uintptr_t) internal_atoms;
+
+    return offset < sizeof(internal_atoms) && offset % NYX_ATOM_WIDTH == 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static int internal_atom_cmp(const void *a, const void *b)
+{
+    return strcmp((STR_t) a, (STR_t) b);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static STR_t internal_key_intern(STR_t key)
+{
+    if(internal_is_atom(key))
+    {
+        return key;
+    }
+
+    /* Every atom starts with one of these characters, other keys cannot be atoms. */
+
+    switch(key[0])
+    {
+        case '$':
+        case '<':
+        case '@':
+        case 'c':
+            break;
+
+        default:
+            return key;
+    }
+
+    STR_t atom = bsearch(key, internal_atoms, NYX_ATOM_NB, NYX_ATOM_WIDTH, internal_atom_cmp);
+
+    return atom != NULL ? atom : key;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ size_t internal_node_size(STR_t key)
+{
+    return internal_is_atom(key) ? sizeof(nyx_dict_node_t) : sizeof(nyx_dict_node_t) + strlen(key) + 1;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* HASH TABLE                                                                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ uint32_t internal_key_hash(STR_t key)
+{
+    return nyx_hash(strlen(key), key, 0);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ bool internal_key_equal(const nyx_dict_node_t *node, uint32_t hash, STR_t key, bool atom)
+{
+    return atom ? node->key == key : node->hash == hash && strcmp(node->key, key) == 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void internal_index_insert(nyx_dict_t *object, nyx_dict_node_t *node)
+{
+    size_t mask = object->capacity - 1;
+
+    size_t pos = node->hash & mask;
+
+    while(object->table[pos] != NULL)
+    {
+        pos = (pos + 1) & mask;
+    }
+
+    object->table[pos] = node;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void internal_index_remove(nyx_dict_t *object, const nyx_dict_node_t *node)
+{
+    size_t mask = object->capacity - 1;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t i = node->hash & mask;
+
+    while(object->table[i] != node)
+    {
+        i = (i + 1) & mask;
+    }
+
+    object->table[i] = NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* BACKWARD SHIFT DELETION                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(size_t j = (i + 1) & mask; object->table[j] != NULL; j = (j + 1) & mask)
+    {
+        size_t k = object->table[j]->hash & mask;
+
+        if(i <= j ? (i < k && k <= j) : (i < k || k <= j))
+        {
+            continue;
+        }
+
+        object->table[i] = object->table[j];
+        object->table[j] = NULL;
+
+        i = j;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void internal_index_rebuild(nyx_dict_t *object, size_t capacity)
+{
+    internal_object_memory_free(&object->base, object->table);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    object->capacity = capacity;
+
+    object->table = memset(nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_OBJECT, capacity * sizeof(nyx_dict_node_t *)), 0x00, capacity * sizeof(nyx_dict_node_t *));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(nyx_dict_node_t *node = object->head; node != NULL; node = node->next)
+    {
+        internal_index_insert(object, node);
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_dict_node_t *internal_lookup(const nyx_dict_t *object, STR_t key)
+{
+    /* Keys of the vocabulary are always stored as atoms, an atom is therefore found by address. */
+
+    bool atom = internal_is_atom(key);
+
+    if(object->table != NULL)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uint32_t hash = internal_key_hash(key);
+
+        size_t mask = object->capacity - 1;
+
+        for(size_t pos = hash & mask; object->table[pos] != NULL; pos = (pos + 1) & mask)
+        {
+            nyx_dict_node_t *node = object->table[pos];
+
+            if(internal_key_equal(node, hash, key, atom))
+            {
+                return node;
+            }
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+    else
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uint32_t hash = atom ? 0x00 : internal_key_hash(key);
+
+        for(nyx_dict_node_t *node = object->head; node != NULL; node = node->next)
+        {
+            if(internal_key_equal(node, hash, key, atom))
+            {
+                return node;
+            }
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* DICT                                                                                                               */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 nyx_dict_t *nyx_dict_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_t *object = nyx_memory_alloc(sizeof(nyx_dict_t));
+    nyx_dict_t *object = nyx_memory_pool_alloc(sizeof(nyx_dict_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_DICT);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    object->size = 0;
+
+    object->capacity = 0;
+    object->table = NULL;
+
     object->head = NULL;
     object->tail = NULL;
 
+    object->cache = NULL;
+
+    object->kind = NYX_VECTOR_KIND_NONE;
+
+    object->node_idx = 0;
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     return object;
@@ -43,7 +282,9 @@ void nyx_dict_free(nyx_dict_t *object)
 {
     internal_dict_clear(object);
 
-    nyx_memory_free(object);
+    internal_dict_uncache(object);
+
+    nyx_memory_pool_free(object, sizeof(nyx_dict_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -66,13 +307,22 @@ static void internal_dict_clear(nyx_dict_t *object)
 
         nyx_object_unref(temp->value);
 
-        nyx_memory_free(temp);
+        internal_object_memory_pool_free(&object->base, temp, internal_node_size(temp->key));
 
         /*------------------------------------------------------------------------------------------------------------*/
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    internal_object_memory_free(&object->base, object->table);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    object->size = 0;
+
+    object->capacity = 0;
+    object->table = NULL;
+
     object->head = NULL;
     object->tail = NULL;
 
@@ -84,6 +334,8 @@ static void internal_dict_clear(nyx_dict_t *object)
 void nyx_dict_clear(nyx_dict_t *object)
 {
     internal_dict_clear(object);
+
+    internal_mark_dirty(&object->base, true);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -92,41 +344,53 @@ void nyx_dict_del(nyx_dict_t *object, STR_t key)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    for(nyx_dict_node_t *prev_node = NULL, *curr_node = object->head; curr_node != NULL; prev_node = curr_node, curr_node = curr_node->next)
+    nyx_dict_node_t *node = internal_lookup(object, key);
+
+    if(node == NULL)
     {
-        if(strcmp(curr_node->key, key) == 0)
-        {
-            /*--------------------------------------------------------------------------------------------------------*/
+        return;
+    }
 
-            if(prev_node == NULL)
-            {
-                object->head = curr_node->next;
-            }
-            else
-            {
-                prev_node->next = curr_node->next;
-            }
+    /*----------------------------------------------------------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------------------------------------------------*/
+    if(object->table != NULL)
+    {
+        internal_index_remove(object, node);
+    }
 
-            if(curr_node == object->tail)
-            {
-                object->tail = prev_node;
-            }
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(node->prev == NULL)
+    {
+        object->head = node->next;
+    }
+    else
+    {
+        node->prev->next = node->next;
+    }
 
-            /*--------------------------------------------------------------------------------------------------------*/
+    if(node->next == NULL)
+    {
+        object->tail = node->prev;
+    }
+    else
+    {
+        node->next->prev = node->prev;
+    }
 
-            curr_node->value->parent = NULL;
+    object->size--;
 
-            nyx_object_unref(curr_node->value);
+    /*----------------------------------------------------------------------------------------------------------------*/
 
-            nyx_memory_free(curr_node);
+    node->value->parent = NULL;
 
-            /*--------------------------------------------------------------------------------------------------------*/
+    nyx_object_unref(node->value);
 
-            break;
-        }
-    }
+    internal_object_memory_pool_free(&object->base, node, internal_node_size(node->key));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    internal_mark_dirty(&object->base, true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 }
@@ -158,19 +422,9 @@ bool nyx_dict_iterate(nyx_dict_iter_t *iter, STR_t *key, nyx_object_t **object)
 
 nyx_object_t *nyx_dict_get(const nyx_dict_t *object, STR_t key)
 {
-    /*----------------------------------------------------------------------------------------------------------------*/
+    nyx_dict_node_t *node = internal_lookup(object, key);
 
-    for(nyx_dict_node_t *curr_node = object->head; curr_node != NULL; curr_node = curr_node->next)
-    {
-        if(strcmp(curr_node->key, key) == 0)
-        {
-            return curr_node->value;
-        }
-    }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    return NULL;
+    return node != NULL ? node->value : NULL;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -179,6 +433,13 @@ bool nyx_dict_set(nyx_dict_t *object, STR_t key, void *value)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    if(internal_arena_frozen(&object->base))
+    {
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
     if(!NYX_OBJECT_CHECK_MAGIC(value))
     {
         NYX_LOG_FATAL("Invalid object");
@@ -207,32 +468,36 @@ bool nyx_dict_set(nyx_dict_t *object, STR_t key, void *value)
 
     bool modified = true;
 
-    for(nyx_dict_node_t *curr_node = /* NOSONAR */ object->head; curr_node != NULL; curr_node = curr_node->next)
+    key = internal_key_intern(key);
+
+    nyx_dict_node_t *curr_node = internal_lookup(object, key);
+
+    if(curr_node != NULL)
     {
-        if(strcmp(curr_node->key, key) == 0)
-        {
-            modified = !nyx_object_equal(curr_node->value, value);
+        modified = !nyx_object_equal(curr_node->value, value);
 
-            curr_node->value->parent = NULL;
+        curr_node->value->parent = NULL;
 
-            nyx_object_ref(/*-*/ value /*-*/);
-            nyx_object_unref(curr_node->value);
+        nyx_object_ref(/*-*/ value /*-*/);
+        nyx_object_unref(curr_node->value);
 
-            curr_node->value = value;
+        curr_node->value = value;
 
-            goto _ok;
-        }
+        goto _ok;
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_node_t *node = nyx_memory_alloc(sizeof(nyx_dict_node_t) + strlen(key) + 1);
+    nyx_dict_node_t *node = nyx_memory_pool_alloc(internal_node_size(key));
+
+    node->key = internal_is_atom(key) ? key : strcpy((str_t) (node + 1), key);
 
-    node->key = strcpy((str_t) (node + 1), key);
+    node->hash = internal_key_hash(key);
 
     nyx_object_ref(value);
 
     node->value = value;
+    node->prev = object->tail;
     node->next = NULL;
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -248,65 +513,116 @@ bool nyx_dict_set(nyx_dict_t *object, STR_t key, void *value)
         object->tail /*-*/ = node;
     }
 
+    object->size++;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(object->table != NULL)
+    {
+        if(2 * object->size > object->capacity)
+        {
+            internal_index_rebuild(object, 2 * object->capacity);
+        }
+        else
+        {
+            internal_index_insert(object, node);
+        }
+    }
+    else if(object->size > NYX_DICT_INDEX_THRESHOLD)
+    {
+        internal_index_rebuild(object, 4 * NYX_DICT_INDEX_THRESHOLD);
+    }
+
     /*----------------------------------------------------------------------------------------------------------------*/
 _ok:
     ((nyx_object_t *) value)->parent = (nyx_object_t *) object;
 
-    return modified;
+    return internal_mark_dirty(&object->base, modified);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 size_t nyx_dict_size(const nyx_dict_t *object)
 {
-    size_t result = 0;
+    return object->size;
+}
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-    for(nyx_dict_node_t *node = object->head; node != NULL; node = node->next, result++) { /* NOSONAR */ }
+str_t nyx_dict_to_string(const nyx_dict_t *object)
+{
+    return internal_object_to_string(&object->base, false);
+}
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* CACHE                                                                                                              */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_dict_cache_t *internal_dict_cache(nyx_dict_t *object)
+{
+    if(object->base.in_arena)
+    {
+        NYX_LOG_FATAL("Arena objects cannot be cached");
+    }
+
+    if(object->cache == NULL)
+    {
+        object->cache = nyx_memory_pool_alloc(sizeof(nyx_dict_cache_t));
 
-    return result;
+        object->cache->json = NULL;
+        object->cache->xml = NULL;
+    }
+
+    return object->cache;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-str_t nyx_dict_to_string(const nyx_dict_t *object)
+STR_t internal_dict_to_cached_string(nyx_dict_t *object)
+{
+    nyx_dict_cache_t *cache = internal_dict_cache(object);
+
+    if(cache->json == NULL)
+    {
+        cache->json = nyx_object_to_string(&object->base);
+    }
+
+    return cache->json;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+STR_t internal_dict_to_cached_xml_string(nyx_dict_t *object)
 {
-    nyx_string_builder_t *sb = nyx_string_builder_new();
-
-    /**/    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "{");
-    /**/
-    /**/    for(nyx_dict_node_t *curr_node = object->head; curr_node != NULL; curr_node = curr_node->next)
-    /**/    {
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/
-    /**/        str_t curr_node_val = nyx_object_to_string(curr_node->value);
-    /**/
-    /**/        nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "\"");
-    /**/        nyx_string_builder_append(sb, NYX_SB_ESCAPE_JSON, curr_node->key);
-    /**/        nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "\"", ":", curr_node_val);
-    /**/
-    /**/        nyx_memory_free(curr_node_val);
-    /**/
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/
-    /**/        if(curr_node->next != NULL)
-    /**/        {
-    /**/            nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, ",");
-    /**/        }
-    /**/
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/    }
-    /**/
-    /**/    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "}");
-
-    str_t result = nyx_string_builder_to_string(sb);
-
-    nyx_string_builder_free(sb);
-
-    return result;
+    #if !defined(ARDUINO)
+    nyx_dict_cache_t *cache = internal_dict_cache(object);
+
+    if(cache->xml == NULL)
+    {
+        cache->xml = nyx_object_to_xml_string(&object->base);
+    }
+
+    return cache->xml;
+    #else
+    (void) object;
+
+    return NULL;
+    #endif
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void internal_dict_uncache(nyx_dict_t *object)
+{
+    if(object->cache != NULL)
+    {
+        nyx_memory_free(object->cache->json);
+        nyx_memory_free(object->cache->xml);
+
+        nyx_memory_pool_free(object->cache, sizeof(nyx_dict_cache_t));
+
+        object->cache = NULL;
+    }
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
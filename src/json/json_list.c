@@ -5,6 +5,8 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#include <string.h>
+
 #include "../nyx_node_internal.h"
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -19,16 +21,20 @@ nyx_list_t *nyx_list_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_list_t *object = nyx_memory_alloc(sizeof(nyx_list_t));
+    nyx_list_t *object = nyx_memory_pool_alloc(sizeof(nyx_list_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_LIST);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    object->head = NULL;
-    object->tail = NULL;
+    object->size = 0;
+    object->capacity = 0;
+
+    object->items = NULL;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -41,7 +47,7 @@ void nyx_list_free(nyx_list_t *object)
 {
     internal_list_clear(object);
 
-    nyx_memory_free(object);
+    nyx_memory_pool_free(object, sizeof(nyx_list_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -50,29 +56,23 @@ static void internal_list_clear(nyx_list_t *object)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    for(nyx_list_node_t *node = object->head; node != NULL;)
+    for(size_t i = 0; i < object->size; i++)
     {
-        /*------------------------------------------------------------------------------------------------------------*/
-
-        nyx_list_node_t *temp = node;
-
-        node = node->next;
-
-        /*------------------------------------------------------------------------------------------------------------*/
+        object->items[i]->parent = NULL;
 
-        temp->value->parent = NULL;
+        nyx_object_unref(object->items[i]);
+    }
 
-        nyx_object_unref(temp->value);
+    /*----------------------------------------------------------------------------------------------------------------*/
 
-        nyx_memory_free(temp);
-
-        /*------------------------------------------------------------------------------------------------------------*/
-    }
+    internal_object_memory_free(&object->base, object->items);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    object->head = NULL;
-    object->tail = NULL;
+    object->size = 0;
+    object->capacity = 0;
+
+    object->items = NULL;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 }
@@ -82,69 +82,53 @@ static void internal_list_clear(nyx_list_t *object)
 void nyx_list_clear(nyx_list_t *object)
 {
     internal_list_clear(object);
+
+    internal_mark_dirty(&object->base, true);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 void nyx_list_del(nyx_list_t *object, size_t idx)
 {
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    for(nyx_list_node_t *prev_node = NULL, *curr_node = object->head; curr_node != NULL; prev_node = curr_node, curr_node = curr_node->next, idx--)
+    if(idx < object->size)
     {
-        if(idx == 0)
-        {
-            /*--------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-            if(prev_node == NULL)
-            {
-                object->head = curr_node->next;
-            }
-            else
-            {
-                prev_node->next = curr_node->next;
-            }
+        nyx_object_t *value = object->items[idx];
 
-            /*--------------------------------------------------------------------------------------------------------*/
+        memmove(object->items + idx, object->items + idx + 1, (object->size - idx - 1) * sizeof(nyx_object_t *));
 
-            if(curr_node == object->tail)
-            {
-                object->tail = prev_node;
-            }
+        object->size--;
 
-            /*--------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-            curr_node->value->parent = NULL;
+        value->parent = NULL;
 
-            nyx_object_unref(curr_node->value);
+        nyx_object_unref(value);
 
-            nyx_memory_free(curr_node);
+        /*------------------------------------------------------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------------------------------------------------*/
+        internal_mark_dirty(&object->base, true);
 
-            break;
-        }
+        /*------------------------------------------------------------------------------------------------------------*/
     }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 bool nyx_list_iterate(nyx_list_iter_t *iter, size_t *idx, nyx_object_t **object)
 {
-    if(iter->head != NULL)
+    if(iter->idx < iter->list->size)
     {
         if(idx != NULL) {
             *idx = iter->idx;
         }
 
         if(object != NULL) {
-            *object = iter->head->value;
+            *object = iter->list->items[iter->idx];
         }
 
         iter->idx += 0x0000000000001;
-        iter->head = iter->head->next;
 
         return true;
     }
@@ -156,19 +140,7 @@ bool nyx_list_iterate(nyx_list_iter_t *iter, size_t *idx, nyx_object_t **object)
 
 nyx_object_t *nyx_list_get(const nyx_list_t *object, size_t idx)
 {
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    for(nyx_list_node_t *curr_node = object->head; curr_node != NULL; curr_node = curr_node->next, idx--)
-    {
-        if(idx == 0)
-        {
-            return curr_node->value;
-        }
-    }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    return NULL;
+    return idx < object->size ? object->items[idx] : NULL;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -177,6 +149,13 @@ bool nyx_list_set(nyx_list_t *object, size_t idx, void *value)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    if(internal_arena_frozen(&object->base))
+    {
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
     if(!NYX_OBJECT_CHECK_MAGIC(value))
     {
         NYX_LOG_FATAL("Invalid object");
@@ -205,101 +184,56 @@ bool nyx_list_set(nyx_list_t *object, size_t idx, void *value)
 
     bool modified = true;
 
-    for(nyx_list_node_t *curr_node = /* NOSONAR */ object->head; curr_node != NULL; curr_node = curr_node->next, idx--)
+    if(idx < object->size)
     {
-        if(idx == 0)
-        {
-            modified = !nyx_object_equal(curr_node->value, value);
+        nyx_object_t *curr_value = object->items[idx];
 
-            curr_node->value->parent = NULL;
+        modified = !nyx_object_equal(curr_value, value);
 
-            nyx_object_ref(/*-*/ value /*-*/);
-            nyx_object_unref(curr_node->value);
+        curr_value->parent = NULL;
 
-            curr_node->value = value;
+        nyx_object_ref(/*-*/ value /*-*/);
+        nyx_object_unref(curr_value);
 
-            goto _ok;
-        }
+        object->items[idx] = value;
+
+        goto _ok;
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_list_node_t *node = nyx_memory_alloc(sizeof(nyx_list_node_t));
-
-    nyx_object_ref(value);
+    if(object->size == object->capacity)
+    {
+        object->capacity = object->capacity == 0 ? 4 : 2 * object->capacity;
 
-    node->value = value;
-    node->next = NULL;
+        object->items = internal_object_memory_realloc(&object->base, NYX_MEMORY_CATEGORY_OBJECT, object->items, object->capacity * sizeof(nyx_object_t *));
+    }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    if(object->head == NULL)
-    {
-        object->head = node;
-        object->tail = node;
-    }
-    else
-    {
-        object->tail->next = node;
-        object->tail /*-*/ = node;
-    }
+    nyx_object_ref(value);
+
+    object->items[object->size++] = value;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 _ok:
     ((nyx_object_t *) value)->parent = (nyx_object_t *) object;
 
-    return modified;
+    return internal_mark_dirty(&object->base, modified);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 size_t nyx_list_size(const nyx_list_t *object)
 {
-    size_t result = 0;
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    for(nyx_list_node_t *node = object->head; node != NULL; node = node->next, result++) { /* NOSONAR */ };
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    return result;
+    return object->size;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 str_t nyx_list_to_string(const nyx_list_t *object)
 {
-    nyx_string_builder_t *sb = nyx_string_builder_new();
-
-    /**/    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "[");
-    /**/
-    /**/    for(nyx_list_node_t *curr_node = object->head; curr_node != NULL; curr_node = curr_node->next)
-    /**/    {
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/
-    /**/        str_t curr_node_val = nyx_object_to_string(curr_node->value);
-    /**/
-    /**/        nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, curr_node_val);
-    /**/
-    /**/        nyx_memory_free(curr_node_val);
-    /**/
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/
-    /**/        if(curr_node->next != NULL)
-    /**/        {
-    /**/            nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, ",");
-    /**/        }
-    /**/        /*----------------------------------------------------------------------------------------------------*/
-    /**/    }
-    /**/
-    /**/    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "]");
-
-    str_t result = nyx_string_builder_to_string(sb);
-
-    nyx_string_builder_free(sb);
-
-    return result;
+    return internal_object_to_string(&object->base, false);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -13,12 +13,14 @@ nyx_null_t *nyx_null_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_null_t *object = nyx_memory_alloc(sizeof(nyx_null_t));
+    nyx_null_t *object = nyx_memory_pool_alloc(sizeof(nyx_null_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_NULL);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     return object;
@@ -28,7 +30,7 @@ nyx_null_t *nyx_null_new(void)
 
 void nyx_null_free(nyx_null_t *object)
 {
-    nyx_memory_free(object);
+    nyx_memory_pool_free(object, sizeof(nyx_null_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -13,12 +13,14 @@ nyx_number_t *nyx_number_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_number_t *object = nyx_memory_alloc(sizeof(nyx_number_t));
+    nyx_number_t *object = nyx_memory_pool_alloc(sizeof(nyx_number_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_NUMBER);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->value = 0.0;
@@ -32,7 +34,7 @@ nyx_number_t *nyx_number_new(void)
 
 void nyx_number_free(nyx_number_t *object)
 {
-    nyx_memory_free(object);
+    nyx_memory_pool_free(object, sizeof(nyx_number_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -50,7 +52,7 @@ bool nyx_number_set(nyx_number_t *object, double value)
     object->value != value;
     object->value = value;
 
-    return modified;
+    return internal_mark_dirty(object->base.parent, modified);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -15,12 +15,14 @@ nyx_string_t *nyx_string_new(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_string_t *object = nyx_memory_alloc(sizeof(nyx_string_t));
+    nyx_string_t *object = nyx_memory_pool_alloc(sizeof(nyx_string_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->base = NYX_OBJECT(NYX_TYPE_STRING);
 
+    object->base.in_arena = internal_arena_active();
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     object->managed = false;
@@ -41,7 +43,7 @@ void nyx_string_free(nyx_string_t *object)
         nyx_memory_free(object->value);
     }
 
-    nyx_memory_free(object);
+    nyx_memory_pool_free(object, sizeof(nyx_string_t));
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -82,6 +84,16 @@ bool nyx_string_set(nyx_string_t *object, STR_t value, bool managed)
         return false;
     }
 
+    if(internal_arena_frozen(&object->base))
+    {
+        if(managed)
+        {
+            nyx_memory_free((buff_t) /* NOSONAR */ value);
+        }
+
+        return false;
+    }
+
     bool modified = strcmp(object->value, value) != 0;
 
     if(modified || object->managed)
@@ -90,7 +102,7 @@ bool nyx_string_set(nyx_string_t *object, STR_t value, bool managed)
 
         if(object->managed)
         {
-            nyx_memory_free(object->value);
+            internal_object_memory_free(&object->base, object->value);
         }
 
         /*------------------------------------------------------------------------------------------------------------*/
@@ -101,7 +113,7 @@ bool nyx_string_set(nyx_string_t *object, STR_t value, bool managed)
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        return modified;
+        return internal_mark_dirty(object->base.parent, modified);
     }
 
     return false;
@@ -118,6 +130,16 @@ bool nyx_string_set_buff(nyx_string_t *object, size_t size, BUFF_t buff, bool ma
         return false;
     }
 
+    if(internal_arena_frozen(&object->base))
+    {
+        if(managed)
+        {
+            nyx_memory_free((buff_t) /* NOSONAR */ buff);
+        }
+
+        return false;
+    }
+
     bool modified = object->length != size || memcmp(object->value, buff, size) != 0;
 
     if(modified || object->managed)
@@ -126,7 +148,7 @@ bool nyx_string_set_buff(nyx_string_t *object, size_t size, BUFF_t buff, bool ma
 
         if(object->managed)
         {
-            nyx_memory_free(object->value);
+            internal_object_memory_free(&object->base, object->value);
         }
 
         /*------------------------------------------------------------------------------------------------------------*/
@@ -137,7 +159,7 @@ bool nyx_string_set_buff(nyx_string_t *object, size_t size, BUFF_t buff, bool ma
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        return modified;
+        return internal_mark_dirty(object->base.parent, modified);
     }
 
     return true;
@@ -26,6 +26,281 @@ static bool _starts_with(const nyx_str_t topic, const nyx_str_t prefix)
     return topic.len >= prefix.len && memcmp(topic.buf, prefix.buf, prefix.len) == 0;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* INDEX                                                                                                              */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    __NYX_NULLABLE__ STR_t device;
+    __NYX_NULLABLE__ STR_t name;
+
+    bool enabled_only;
+
+    uint32_t hash;
+    size_t pos;
+
+} nyx_index_iter_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ uint32_t _device_hash(STR_t device)
+{
+    return nyx_hash(strlen(device), device, NYX_OBJECT_MAGIC);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ uint32_t _vector_hash(STR_t device, STR_t name)
+{
+    return nyx_hash(strlen(name), name, _device_hash(device));
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _index_clear(nyx_index_t *index)
+{
+    nyx_memory_free(index->vector_slots);
+    nyx_memory_free(index->device_slots);
+    nyx_memory_free(index->device_next);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _index_build(nyx_index_t *index, nyx_dict_t *vectors[])
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t nb_vectors = 0;
+
+    for(nyx_dict_t **vector_ptr = vectors; *vector_ptr != NULL; vector_ptr++, nb_vectors++) { /* NOSONAR */ }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t capacity = 16;
+
+    while(capacity < 2 * nb_vectors)
+    {
+        capacity <<= 1;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    index->mask = capacity - 1;
+
+    index->vector_slots = memset(nyx_memory_alloc(capacity * sizeof(nyx_index_slot_t)), 0x00, capacity * sizeof(nyx_index_slot_t));
+    index->device_slots = memset(nyx_memory_alloc(capacity * sizeof(nyx_index_slot_t)), 0x00, capacity * sizeof(nyx_index_slot_t));
+
+    index->device_next = memset(nyx_memory_alloc((nb_vectors + 1) * sizeof(uint32_t)), 0x00, (nb_vectors + 1) * sizeof(uint32_t));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    uint32_t *device_tails = nyx_memory_alloc(capacity * sizeof(uint32_t));
+
+    for(uint32_t i = 0; i < nb_vectors; i++)
+    {
+        nyx_dict_t *vector = vectors[i];
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        STR_t device = nyx_dict_get_string(vector, NYX_ATOM(DEVICE));
+        STR_t name = nyx_dict_get_string(vector, NYX_ATOM(NAME));
+
+        if(device == NULL || name == NULL)
+        {
+            continue;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* (DEVICE, NAME) -> VECTOR                                                                                   */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uint32_t hash = _vector_hash(device, name);
+
+        size_t pos = hash & index->mask;
+
+        while(index->vector_slots[pos].idx != 0)
+        {
+            pos = (pos + 1) & index->mask;
+        }
+
+        index->vector_slots[pos].hash = hash;
+        index->vector_slots[pos].idx = i + 1;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* DEVICE -> VECTOR CHAIN                                                                                     */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        hash = _device_hash(device);
+
+        pos = hash & index->mask;
+
+        while(index->device_slots[pos].idx != 0)
+        {
+            if(index->device_slots[pos].hash == hash && strcmp(device, nyx_dict_get_string(vectors[index->device_slots[pos].idx - 1], NYX_ATOM(DEVICE))) == 0)
+            {
+                break;
+            }
+
+            pos = (pos + 1) & index->mask;
+        }
+
+        if(index->device_slots[pos].idx == 0)
+        {
+            index->device_slots[pos].hash = hash;
+            index->device_slots[pos].idx = i + 1;
+        }
+        else
+        {
+            index->device_next[device_tails[pos] - 1] = i + 1;
+        }
+
+        device_tails[pos] = i + 1;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    nyx_memory_free(device_tails);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_index_iter_t _index_iter(const nyx_node_t *node, __NYX_NULLABLE__ STR_t device, __NYX_NULLABLE__ STR_t name, bool enabled_only)
+{
+    const nyx_index_t *index = node->index;
+
+    nyx_index_iter_t result = {
+        .device = device,
+        .name = name,
+        .enabled_only = enabled_only,
+        .hash = 0,
+        .pos = 0,
+    };
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(device != NULL)
+    {
+        if(name != NULL)
+        {
+            /*--------------------------------------------------------------------------------------------------------*/
+
+            result.hash = _vector_hash(device, name);
+
+            result.pos = result.hash & index->mask;
+
+            /*--------------------------------------------------------------------------------------------------------*/
+        }
+        else
+        {
+            /*--------------------------------------------------------------------------------------------------------*/
+
+            uint32_t hash = _device_hash(device);
+
+            for(size_t pos = hash & index->mask; index->device_slots[pos].idx != 0; pos = (pos + 1) & index->mask)
+            {
+                if(index->device_slots[pos].hash == hash && strcmp(device, nyx_dict_get_string(node->vectors[index->device_slots[pos].idx - 1], NYX_ATOM(DEVICE))) == 0)
+                {
+                    result.pos = index->device_slots[pos].idx;
+
+                    break;
+                }
+            }
+
+            /*--------------------------------------------------------------------------------------------------------*/
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_dict_t *_index_next(const nyx_node_t *node, nyx_index_iter_t *iter)
+{
+    const nyx_index_t *index = node->index;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* ALL VECTORS                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(iter->device == NULL)
+    {
+        nyx_dict_t *vector;
+
+        while((vector = node->vectors[iter->pos]) != NULL)
+        {
+            iter->pos++;
+
+            if(!iter->enabled_only || (vector->base.flags & NYX_FLAGS_DISABLED) == 0)
+            {
+                return vector;
+            }
+        }
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* VECTORS OF A DEVICE                                                                                            */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(iter->name == NULL)
+    {
+        while(iter->pos != 0)
+        {
+            nyx_dict_t *vector = node->vectors[iter->pos - 1];
+
+            iter->pos = index->device_next[iter->pos - 1];
+
+            if(!iter->enabled_only || (vector->base.flags & NYX_FLAGS_DISABLED) == 0)
+            {
+                return vector;
+            }
+        }
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* VECTOR OF A DEVICE                                                                                             */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(index->vector_slots[iter->pos].idx != 0)
+    {
+        const nyx_index_slot_t *slot = &index->vector_slots[iter->pos];
+
+        iter->pos = (iter->pos + 1) & index->mask;
+
+        if(slot->hash == iter->hash)
+        {
+            nyx_dict_t *vector = node->vectors[slot->idx - 1];
+
+            STR_t device = nyx_dict_get_string(vector, NYX_ATOM(DEVICE));
+            STR_t name = nyx_dict_get_string(vector, NYX_ATOM(NAME));
+
+            if(device != NULL && strcmp(iter->device, device) == 0
+               &&
+               name != NULL && strcmp(iter->name, name) == 0
+               &&
+               (!iter->enabled_only || (vector->base.flags & NYX_FLAGS_DISABLED) == 0)
+            ) {
+                return vector;
+            }
+        }
+    }
+
+    return NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* NODE                                                                                                               */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -41,48 +316,99 @@ static const nyx_str_t SPECIAL_TOPICS[] = {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _sub_object(const nyx_node_t *node, const nyx_object_t *object)
+/* A reply to a single INDI client (`client` not NULL) is sent to that client only, as indiserver does. */
+
+static void _sub_string(const nyx_node_t *node, __NYX_UNUSED__ __NYX_NULLABLE__ STR_t xml, STR_t json, __NYX_NULLABLE__ const void *client)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
     #if !defined(ARDUINO)
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    if(node->enable_xml)
+    if(client != NULL)
     {
-        nyx_xmldoc_t *xmldoc = nyx_object_to_xmldoc(object);
-
-        if(xmldoc != NULL)
+        if(xml != NULL)
         {
-            /*--------------------------------------------------------------------------------------------------------*/
+            internal_indi_pub(node, nyx_str_s(xml), client);
+        }
 
-            str_t xml = nyx_xmldoc_to_string(xmldoc);
-            internal_mqtt_pub(node, nyx_str_s("nyx/xml"), nyx_str_s(xml), 2);
-            internal_indi_pub(node, nyx_str_s(xml));
-            nyx_memory_free(xml);
+        return;
+    }
 
-            /*--------------------------------------------------------------------------------------------------------*/
+    if(xml != NULL)
+    {
+        internal_mqtt_pub(node, nyx_str_s("nyx/xml"), nyx_str_s(xml), 2);
+        internal_indi_pub(node, nyx_str_s(xml), NULL);
+    }
 
-            nyx_xmldoc_free(xmldoc);
+    /*----------------------------------------------------------------------------------------------------------------*/
+    #endif
+    /*----------------------------------------------------------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------------------------------------------------*/
-        }
+    internal_mqtt_pub(node, nyx_str_s("nyx/json"), nyx_str_s(json), 2);
+    ////////_indi_pub(node, nyx_str_s(json));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Packed notifications have their own topics, `nyx/json` and `nyx/xml` always carry a single message. */
+
+static void _sub_batch(const nyx_node_t *node, __NYX_UNUSED__ __NYX_NULLABLE__ STR_t xml, STR_t json)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+    #if !defined(ARDUINO)
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(xml != NULL)
+    {
+        internal_mqtt_pub(node, nyx_str_s("nyx/xml/batch"), nyx_str_s(xml), 2);
+        internal_indi_pub(node, nyx_str_s(xml), NULL);
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
     #endif
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    internal_mqtt_pub(node, nyx_str_s("nyx/json/batch"), nyx_str_s(json), 2);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _sub_object(const nyx_node_t *node, const nyx_object_t *object)
+{
+    #if !defined(ARDUINO)
+    str_t xml = node->enable_xml ? nyx_object_to_xml_string(object) : NULL;
+    #else
+    str_t xml = NULL;
+    #endif
+
     str_t json = nyx_object_to_string(object);
-    internal_mqtt_pub(node, nyx_str_s("nyx/json"), nyx_str_s(json), 2);
-    ////////_indi_pub(node, nyx_str_s(json));
+
+    _sub_string(node, xml, json, NULL);
+
     nyx_memory_free(json);
+    nyx_memory_free(xml);
+}
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Definitions are served from the serialized forms cached by the vectors, see internal_dict_to_cached_string(). */
+
+static void _sub_vector(const nyx_node_t *node, nyx_dict_t *vector, __NYX_NULLABLE__ const void *client)
+{
+    STR_t xml = node->enable_xml ? internal_dict_to_cached_xml_string(vector) : NULL;
+
+    STR_t json = internal_dict_to_cached_string(vector);
+
+    _sub_string(node, xml, json, client);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _get_properties(const nyx_node_t *node, const nyx_dict_t *dict)
+static void _get_properties(const nyx_node_t *node, const nyx_dict_t *dict, __NYX_NULLABLE__ const void *client)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
     /* GET PROPERTIES                                                                                                 */
@@ -93,8 +419,8 @@ static void _get_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
     if(dict != NULL)
     {
-        device1 = nyx_dict_get_string(dict, "@device");
-        name1 = nyx_dict_get_string(dict, "@name");
+        device1 = nyx_dict_get_string(dict, NYX_ATOM(DEVICE));
+        name1 = nyx_dict_get_string(dict, NYX_ATOM(NAME));
     }
     else
     {
@@ -104,48 +430,23 @@ static void _get_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    for(nyx_dict_t **vector_ptr = node->vectors; *vector_ptr != NULL; vector_ptr++)
-    {
-        nyx_dict_t *vector = *vector_ptr;
-
-        if((vector->base.flags & NYX_FLAGS_DISABLED) == 0)
-        {
-            /*--------------------------------------------------------------------------------------------------------*/
-
-            STR_t device2 = nyx_dict_get_string(vector, "@device");
-            STR_t name2 = nyx_dict_get_string(vector, "@name");
-
-            /*--------------------------------------------------------------------------------------------------------*/
-
-            if(device2 != NULL && name2 != NULL)
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                if(device1 != NULL)
-                {
-                    if(strcmp(device1, device2) != 0)
-                    {
-                        continue;
-                    }
-
-                    if(name1 != NULL)
-                    {
-                        if(strcmp(name1, name2) != 0)
-                        {
-                            continue;
-                        }
-                    }
-                }
+    nyx_dict_t *vector;
 
-                /*----------------------------------------------------------------------------------------------------*/
+    for(nyx_index_iter_t index_iter = _index_iter(node, device1, name1, true); (vector = _index_next(node, &index_iter)) != NULL;)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
 
-                _sub_object(node, (nyx_object_t *) vector);
+        STR_t device2 = nyx_dict_get_string(vector, NYX_ATOM(DEVICE));
+        STR_t name2 = nyx_dict_get_string(vector, NYX_ATOM(NAME));
 
-                /*----------------------------------------------------------------------------------------------------*/
-            }
+        /*------------------------------------------------------------------------------------------------------------*/
 
-            /*--------------------------------------------------------------------------------------------------------*/
+        if(device2 != NULL && name2 != NULL)
+        {
+            _sub_vector(node, vector, client);
         }
+
+        /*------------------------------------------------------------------------------------------------------------*/
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -185,11 +486,11 @@ static int _get_client_index(nyx_node_t *node, STR_t client)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _enable_xxx(nyx_node_t *node, const nyx_dict_t *dict, STR_t tag, int (* str_to_xxx)(STR_t), uint64_t mask)
+static void _enable_xxx(nyx_node_t *node, const nyx_dict_t *dict, nyx_vector_kind_t kind, int (* str_to_xxx)(STR_t), uint64_t mask)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    STR_t client = nyx_dict_get_string(dict, "@client");
+    STR_t client = nyx_dict_get_string(dict, NYX_ATOM(CLIENT));
 
     int index = _get_client_index(node, client);
 
@@ -202,9 +503,9 @@ static void _enable_xxx(nyx_node_t *node, const nyx_dict_t *dict, STR_t tag, int
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    STR_t device1 = nyx_dict_get_string(dict, "@device");
-    STR_t name1 = nyx_dict_get_string(dict, "@name");
-    STR_t value1 = nyx_dict_get_string(dict, "$");
+    STR_t device1 = nyx_dict_get_string(dict, NYX_ATOM(DEVICE));
+    STR_t name1 = nyx_dict_get_string(dict, NYX_ATOM(NAME));
+    STR_t value1 = nyx_dict_get_string(dict, NYX_ATOM(CONTENT));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -212,37 +513,18 @@ static void _enable_xxx(nyx_node_t *node, const nyx_dict_t *dict, STR_t tag, int
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    for(nyx_dict_t **vector_ptr = node->vectors; *vector_ptr != NULL; vector_ptr++)
-    {
-        nyx_dict_t *vector = *vector_ptr;
-
-        /*------------------------------------------------------------------------------------------------------------*/
-
-        STR_t device2 = nyx_dict_get_string(vector, "@device");
-        STR_t name2 = nyx_dict_get_string(vector, "@name");
-        STR_t tag2 = nyx_dict_get_string(vector, "<>");
+    nyx_dict_t *vector;
 
+    for(nyx_index_iter_t index_iter = _index_iter(node, device1, name1, false); (vector = _index_next(node, &index_iter)) != NULL;)
+    {
         /*------------------------------------------------------------------------------------------------------------*/
 
-        if(device1 != NULL)
-        {
-            if(device2 == NULL || strcmp(device1, device2) != 0)
-            {
-                continue;
-            }
-
-            if(name1 != NULL)
-            {
-                if(name2 == NULL || strcmp(name1, name2) != 0)
-                {
-                    continue;
-                }
-            }
-        }
+        STR_t device2 = nyx_dict_get_string(vector, NYX_ATOM(DEVICE));
+        STR_t name2 = nyx_dict_get_string(vector, NYX_ATOM(NAME));
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        if(tag2 != NULL && strcmp(tag, tag2) == 0)
+        if(vector->kind == kind)
         {
             /*--------------------------------------------------------------------------------------------------------*/
 
@@ -299,14 +581,14 @@ static void _enable_xxx(nyx_node_t *node, const nyx_dict_t *dict, STR_t tag, int
 
 __NYX_INLINE__ void _enable_blob(nyx_node_t *node, const nyx_dict_t *dict)
 {
-    _enable_xxx(node, dict, "defBLOBVector", (int (*)(STR_t)) &nyx_str_to_blob_state, NYX_FLAGS_BLOB_MASK);
+    _enable_xxx(node, dict, NYX_VECTOR_KIND_BLOB, (int (*)(STR_t)) &nyx_str_to_blob_state, NYX_FLAGS_BLOB_MASK);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 __NYX_INLINE__ void _enable_stream(nyx_node_t *node, const nyx_dict_t *dict)
 {
-    _enable_xxx(node, dict, "defStreamVector", (int (*)(STR_t)) &nyx_str_to_stream_state, NYX_FLAGS_STREAM_MASK);
+    _enable_xxx(node, dict, NYX_VECTOR_KIND_STREAM, (int (*)(STR_t)) &nyx_str_to_stream_state, NYX_FLAGS_STREAM_MASK);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -324,7 +606,7 @@ static bool _is_allowed(const nyx_node_t *node, const nyx_dict_t *dict)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    STR_t client2 = nyx_dict_get_string(dict, "@client");
+    STR_t client2 = nyx_dict_get_string(dict, NYX_ATOM(CLIENT));
 
     if(client1 != NULL && client2 != NULL && strcmp(client1, client2) == 0)
     {
@@ -347,7 +629,7 @@ static nyx_string_t OFF = {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
+static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict, nyx_vector_kind_t kind)
 {
     if(!_is_allowed(node, dict))
     {
@@ -356,16 +638,13 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_object_t *tag1_string = nyx_dict_get(dict, "<>");
-    nyx_object_t *device1_string = nyx_dict_get(dict, "@device");
-    nyx_object_t *name1_string = nyx_dict_get(dict, "@name");
-    nyx_object_t *children1_list = nyx_dict_get(dict, "children");
+    nyx_object_t *device1_string = nyx_dict_get(dict, NYX_ATOM(DEVICE));
+    nyx_object_t *name1_string = nyx_dict_get(dict, NYX_ATOM(NAME));
+    nyx_object_t *children1_list = nyx_dict_get(dict, NYX_ATOM(CHILDREN));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    if(tag1_string != NULL && tag1_string->type == NYX_TYPE_STRING
-       &&
-       device1_string != NULL && device1_string->type == NYX_TYPE_STRING
+    if(device1_string != NULL && device1_string->type == NYX_TYPE_STRING
        &&
        name1_string != NULL && name1_string->type == NYX_TYPE_STRING
        &&
@@ -373,28 +652,24 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
     ) {
         /*------------------------------------------------------------------------------------------------------------*/
 
-        STR_t tag1 = nyx_string_get((nyx_string_t *) tag1_string);
         STR_t device1 = nyx_string_get((nyx_string_t *) device1_string);
         STR_t name1 = nyx_string_get((nyx_string_t *) name1_string);
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        for(nyx_dict_t **vector_ptr = node->vectors; *vector_ptr != NULL; vector_ptr++)
-        {
-            nyx_dict_t *vector = *vector_ptr;
+        nyx_dict_t *vector;
 
+        for(nyx_index_iter_t index_iter = _index_iter(node, device1, name1, false); (vector = _index_next(node, &index_iter)) != NULL;)
+        {
             /*--------------------------------------------------------------------------------------------------------*/
 
-            nyx_object_t *tag2_string = nyx_dict_get(vector, "<>");
-            nyx_object_t *device2_string = nyx_dict_get(vector, "@device");
-            nyx_object_t *name2_string = nyx_dict_get(vector, "@name");
-            nyx_object_t *children2_list = nyx_dict_get(vector, "children");
+            nyx_object_t *device2_string = nyx_dict_get(vector, NYX_ATOM(DEVICE));
+            nyx_object_t *name2_string = nyx_dict_get(vector, NYX_ATOM(NAME));
+            nyx_object_t *children2_list = nyx_dict_get(vector, NYX_ATOM(CHILDREN));
 
             /*--------------------------------------------------------------------------------------------------------*/
 
-            if(tag2_string != NULL && tag2_string->type == NYX_TYPE_STRING
-               &&
-               device2_string != NULL && device2_string->type == NYX_TYPE_STRING
+            if(device2_string != NULL && device2_string->type == NYX_TYPE_STRING
                &&
                name2_string != NULL && name2_string->type == NYX_TYPE_STRING
                &&
@@ -402,15 +677,12 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
             ) {
                 /*----------------------------------------------------------------------------------------------------*/
 
-                STR_t tag2 = nyx_string_get((nyx_string_t *) tag2_string);
                 STR_t device2 = nyx_string_get((nyx_string_t *) device2_string);
                 STR_t name2 = nyx_string_get((nyx_string_t *) name2_string);
 
                 /*----------------------------------------------------------------------------------------------------*/
 
-                if(strlen(tag1) > 3 && strlen(tag2) > 3     // skip "def" and "new" suffixes
-                   &&
-                   strcmp(tag1 + 3, tag2 + 3) == 0
+                if(vector->kind == kind
                    &&
                    strcmp(device1, device2) == 0
                    &&
@@ -424,11 +696,9 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
                     bool vector_modified = false;
 
-                    uint32_t hash = nyx_hash(strlen(tag2), tag2, 0);
-
                     /*------------------------------------------------------------------------------------------------*/
 
-                    STR_t rule = nyx_dict_get_string(vector, "@rule");
+                    STR_t rule = nyx_dict_get_string(vector, NYX_ATOM(RULE));
 
                     bool is_one_of_many = rule != NULL && strcmp(rule, "OneOfMany") == 0;
 
@@ -438,7 +708,7 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
                     {
                         if(object1->type == NYX_TYPE_DICT)
                         {
-                            nyx_object_t *prop1_string = nyx_dict_get((nyx_dict_t *) object1, "@name");
+                            nyx_object_t *prop1_string = nyx_dict_get((nyx_dict_t *) object1, NYX_ATOM(NAME));
 
                             if(prop1_string != NULL && prop1_string->type == NYX_TYPE_STRING)
                             {
@@ -450,7 +720,7 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
                                 {
                                     if(object2->type == NYX_TYPE_DICT)
                                     {
-                                        nyx_object_t *prop2_string = nyx_dict_get((nyx_dict_t *) object2, "@name");
+                                        nyx_object_t *prop2_string = nyx_dict_get((nyx_dict_t *) object2, NYX_ATOM(NAME));
 
                                         if(prop2_string != NULL && prop2_string->type == NYX_TYPE_STRING)
                                         {
@@ -464,8 +734,8 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
                                             {
                                                 /*--------------------------------------------------------------------*/
 
-                                                nyx_object_t *old_value = /*--------*/ nyx_dict_get((nyx_dict_t *) object2, "$");
-                                                nyx_object_t *new_value = is_current ? nyx_dict_get((nyx_dict_t *) object1, "$")
+                                                nyx_object_t *old_value = /*--------*/ nyx_dict_get((nyx_dict_t *) object2, NYX_ATOM(CONTENT));
+                                                nyx_object_t *new_value = is_current ? nyx_dict_get((nyx_dict_t *) object1, NYX_ATOM(CONTENT))
                                                                                      : (nyx_object_t *) &OFF
                                                 ;
 
@@ -474,13 +744,13 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
                                                 bool success = false;
                                                 bool modified = false;
 
-                                                switch(hash)
+                                                switch(kind)
                                                 {
                                                     /*----------------------------------------------------------------*/
 
-                                                    case 0x56BE29BD:    // defNumberVector
+                                                    case NYX_VECTOR_KIND_NUMBER:
                                                         {
-                                                            nyx_object_t *format_string = nyx_dict_get((nyx_dict_t *) object2, "@format");
+                                                            nyx_object_t *format_string = nyx_dict_get((nyx_dict_t *) object2, NYX_ATOM(FORMAT));
 
                                                             if(format_string != NULL && format_string->type == NYX_TYPE_STRING)
                                                             {
@@ -493,27 +763,27 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
                                                                 {
                                                                     case NYX_VARIANT_TYPE_INT:
                                                                         if((success = object2->callback._int == NULL || object2->callback._int(vector, (nyx_dict_t *) object2, new_val.value._int, old_val.value._int))) {
-                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", internal_variant_to_string(format, new_val), true);
+                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), internal_variant_to_string(format, new_val), true);
                                                                         }
                                                                         break;
                                                                     case NYX_VARIANT_TYPE_UINT:
                                                                         if((success = object2->callback._uint == NULL || object2->callback._uint(vector, (nyx_dict_t *) object2, new_val.value._uint, old_val.value._uint))) {
-                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", internal_variant_to_string(format, new_val), true);
+                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), internal_variant_to_string(format, new_val), true);
                                                                         }
                                                                         break;
                                                                     case NYX_VARIANT_TYPE_LONG:
                                                                         if((success = object2->callback._long == NULL || object2->callback._long(vector, (nyx_dict_t *) object2, new_val.value._long, old_val.value._long))) {
-                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", internal_variant_to_string(format, new_val), true);
+                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), internal_variant_to_string(format, new_val), true);
                                                                         }
                                                                         break;
                                                                     case NYX_VARIANT_TYPE_ULONG:
                                                                         if((success = object2->callback._ulong == NULL || object2->callback._ulong(vector, (nyx_dict_t *) object2, new_val.value._ulong, old_val.value._ulong))) {
-                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", internal_variant_to_string(format, new_val), true);
+                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), internal_variant_to_string(format, new_val), true);
                                                                         }
                                                                         break;
                                                                     case NYX_VARIANT_TYPE_DOUBLE:
                                                                         if((success = object2->callback._double == NULL || object2->callback._double(vector, (nyx_dict_t *) object2, new_val.value._double, old_val.value._double))) {
-                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", internal_variant_to_string(format, new_val), true);
+                                                                            modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), internal_variant_to_string(format, new_val), true);
                                                                         }
                                                                         break;
                                                                 }
@@ -524,14 +794,14 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
                                                     /*----------------------------------------------------------------*/
 
-                                                    case 0x1FD73301:    // defTextVector
+                                                    case NYX_VECTOR_KIND_TEXT:
                                                         {
                                                             STR_t old_val = nyx_string_get((nyx_string_t *) old_value);
                                                             STR_t new_val = nyx_string_get((nyx_string_t *) new_value);
 
                                                             if((success = object2->callback._str == NULL || object2->callback._str(vector, (nyx_dict_t *) object2, new_val, old_val)))
                                                             {
-                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", nyx_string_dup(new_val), true);
+                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), nyx_string_dup(new_val), true);
                                                             }
                                                         }
 
@@ -539,14 +809,14 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
                                                     /*----------------------------------------------------------------*/
 
-                                                    case 0xFEC07AA7:    // defLightVector
+                                                    case NYX_VECTOR_KIND_LIGHT:
                                                         {
                                                             nyx_state_t old_val = nyx_str_to_state(nyx_string_get((nyx_string_t *) old_value));
                                                             nyx_state_t new_val = nyx_str_to_state(nyx_string_get((nyx_string_t *) new_value));
 
                                                             if((success = object2->callback._int == NULL || object2->callback._int(vector, (nyx_dict_t *) object2, (int) new_val, (int) old_val)))
                                                             {
-                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", nyx_state_to_str(new_val), false);
+                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), nyx_state_to_str(new_val), false);
                                                             }
                                                         }
 
@@ -554,21 +824,21 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
                                                     /*----------------------------------------------------------------*/
 
-                                                    case 0x17C598B1:    // defSwitchVector
+                                                    case NYX_VECTOR_KIND_SWITCH:
                                                         {
                                                             nyx_onoff_t old_val = nyx_str_to_onoff(nyx_string_get((nyx_string_t *) old_value));
                                                             nyx_onoff_t new_val = nyx_str_to_onoff(nyx_string_get((nyx_string_t *) new_value));
 
                                                             if((success = object2->callback._int == NULL || object2->callback._int(vector, (nyx_dict_t *) object2, (int) new_val, (int) old_val)))
                                                             {
-                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, "$", nyx_onoff_to_str(new_val), false);
+                                                                modified = nyx_dict_set_string((nyx_dict_t *) object2, NYX_ATOM(CONTENT), nyx_onoff_to_str(new_val), false);
                                                             }
                                                         }
                                                         break;
 
                                                     /*----------------------------------------------------------------*/
 
-                                                    case 0x29BFE4D7:    // defBLOBVector
+                                                    case NYX_VECTOR_KIND_BLOB:
                                                         {
                                                             /*--------------------------------------------------------*/
 
@@ -593,7 +863,7 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
                                                             if((success = object2->callback._buffer == NULL || object2->callback._buffer(vector, (nyx_dict_t *) object2, dst_size, dst_buff)))
                                                             {
-                                                                modified = nyx_dict_set_buff((nyx_dict_t *) object2, "$", dst_size, dst_buff, true);
+                                                                modified = nyx_dict_set_buff((nyx_dict_t *) object2, NYX_ATOM(CONTENT), dst_size, dst_buff, true);
                                                             }
                                                             else
                                                             {
@@ -665,37 +935,93 @@ static void _set_properties(const nyx_node_t *node, const nyx_dict_t *dict)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _process_message(nyx_node_t *node, nyx_object_t *object)
+typedef enum
+{
+    NYX_MESSAGE_GET_PROPERTIES,
+    NYX_MESSAGE_ENABLE_BLOB,
+    NYX_MESSAGE_ENABLE_STREAM,
+    NYX_MESSAGE_NEW_VECTOR,
+
+} nyx_message_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    nyx_str_t tag;
+
+    nyx_message_t message;
+
+    nyx_vector_kind_t kind;
+
+} nyx_message_slot_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Perfect hash over the inbound tags, every tag falls into its own slot. */
+
+#define NYX_MESSAGE_HASH(tag, len) \
+            ((7U * (len) + (uint8_t) (tag)[3]) & 15U)
+
+static const nyx_message_slot_t MESSAGE_SLOTS[16] = {
+    [ 6] = {NYX_C_STR("enableStream"), NYX_MESSAGE_ENABLE_STREAM, NYX_VECTOR_KIND_STREAM},
+    [ 7] = {NYX_C_STR("newNumberVector"), NYX_MESSAGE_NEW_VECTOR, NYX_VECTOR_KIND_NUMBER},
+    [ 8] = {NYX_C_STR("enableBLOB"), NYX_MESSAGE_ENABLE_BLOB, NYX_VECTOR_KIND_BLOB},
+    [11] = {NYX_C_STR("getProperties"), NYX_MESSAGE_GET_PROPERTIES, NYX_VECTOR_KIND_NONE},
+    [12] = {NYX_C_STR("newSwitchVector"), NYX_MESSAGE_NEW_VECTOR, NYX_VECTOR_KIND_SWITCH},
+    [13] = {NYX_C_STR("newBLOBVector"), NYX_MESSAGE_NEW_VECTOR, NYX_VECTOR_KIND_BLOB},
+    [14] = {NYX_C_STR("newLightVector"), NYX_MESSAGE_NEW_VECTOR, NYX_VECTOR_KIND_LIGHT},
+    [15] = {NYX_C_STR("newTextVector"), NYX_MESSAGE_NEW_VECTOR, NYX_VECTOR_KIND_TEXT},
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static __NYX_NULLABLE__ const nyx_message_slot_t *_classify_message(STR_t tag)
+{
+    size_t len = strlen(tag);
+
+    if(len > 3)
+    {
+        const nyx_message_slot_t *slot = &MESSAGE_SLOTS[NYX_MESSAGE_HASH(tag, len)];
+
+        if(slot->tag.len == len && memcmp(slot->tag.buf, tag, len) == 0)
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _process_message(nyx_node_t *node, nyx_object_t *object, __NYX_NULLABLE__ const void *client)
 {
     if(object->type == NYX_TYPE_DICT)
     {
-        STR_t tag = nyx_dict_get_string((nyx_dict_t *) object, "<>");
+        STR_t tag = nyx_dict_get_string((nyx_dict_t *) object, NYX_ATOM(TAG));
+
+        const nyx_message_slot_t *slot;
 
-        if(tag != NULL)
+        if(tag != NULL && (slot = _classify_message(tag)) != NULL)
         {
-            /**/ if(strcmp(tag, "getProperties") == 0)
+            switch(slot->message)
             {
-                _get_properties(node, (nyx_dict_t *) object);
-            }
-            else if(strcmp(tag, "enableBLOB") == 0)
-            {
-                _enable_blob(node, (nyx_dict_t *) object);
-            }
-            else if(strcmp(tag, "enableStream") == 0)
-            {
-                _enable_stream(node, (nyx_dict_t *) object);
-            }
-            else if(strcmp(tag, "newNumberVector") == 0
-                    ||
-                    strcmp(tag, "newTextVector") == 0
-                    ||
-                    strcmp(tag, "newLightVector") == 0
-                    ||
-                    strcmp(tag, "newSwitchVector") == 0
-                    ||
-                    strcmp(tag, "newBLOBVector") == 0
-            ) {
-                _set_properties(node, (nyx_dict_t *) object);
+                case NYX_MESSAGE_GET_PROPERTIES:
+                    _get_properties(node, (nyx_dict_t *) object, client);
+                    break;
+
+                case NYX_MESSAGE_ENABLE_BLOB:
+                    _enable_blob(node, (nyx_dict_t *) object);
+                    break;
+
+                case NYX_MESSAGE_ENABLE_STREAM:
+                    _enable_stream(node, (nyx_dict_t *) object);
+                    break;
+
+                case NYX_MESSAGE_NEW_VECTOR:
+                    _set_properties(node, (nyx_dict_t *) object, slot->kind);
+                    break;
             }
         }
     }
@@ -705,7 +1031,7 @@ static void _process_message(nyx_node_t *node, nyx_object_t *object)
 #if !defined(ARDUINO)
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static size_t _tcp_handler(nyx_node_t *node, nyx_event_type_t event_type, const nyx_str_t payload)
+static size_t _tcp_handler(nyx_node_t *node, nyx_event_type_t event_type, const void *client, nyx_xml_stream_t *xml_stream, const nyx_str_t payload)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
     /* NYX_NODE_EVENT_MSG                                                                                             */
@@ -713,37 +1039,27 @@ static size_t _tcp_handler(nyx_node_t *node, nyx_event_type_t event_type, const
 
     if(event_type == NYX_NODE_EVENT_MSG)
     {
-        nyx_xml_stream_t xml_stream = NYX_XML_STREAM();
-
-        if(nyx_xml_stream_detect_opening_tag(&xml_stream, payload.len, payload.buf))
+        while(nyx_xml_stream_next(xml_stream, payload.len, payload.buf))
         {
-            if(nyx_xml_stream_detect_closing_tag(&xml_stream, payload.len, payload.buf))
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                nyx_xmldoc_t *xmldoc = nyx_xmldoc_parse_buff(xml_stream.len, xml_stream.s_ptr);
+            /*--------------------------------------------------------------------------------------------------------*/
 
-                if(xmldoc != NULL)
-                {
-                    nyx_object_t *object = nyx_xmldoc_to_object(xmldoc);
+            nyx_arena_t *arena = internal_arena_begin();
 
-                    if(object != NULL)
-                    {
-                        _process_message(node, object);
+            nyx_object_t *object = nyx_xml_buff_to_object(xml_stream->len, xml_stream->s_ptr);
 
-                        nyx_object_unref(object);
-                    }
-
-                    nyx_xmldoc_free(xmldoc);
-                }
+            internal_arena_end(arena, object);
 
-                /*----------------------------------------------------------------------------------------------------*/
-
-                return xml_stream.pos + xml_stream.len;
+            if(object != NULL)
+            {
+                _process_message(node, object, client);
 
-                /*----------------------------------------------------------------------------------------------------*/
+                nyx_object_unref(object);
             }
+
+            /*--------------------------------------------------------------------------------------------------------*/
         }
+
+        return nyx_xml_stream_consume(xml_stream);
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -796,7 +1112,7 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        _get_properties(node, NULL);
+        _get_properties(node, NULL, NULL);
 
         /*------------------------------------------------------------------------------------------------------------*/
     }
@@ -809,6 +1125,24 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
     {
         if(event_topic.len > 0 && event_topic.buf != NULL)
         {
+            /*--------------------------------------------------------------------------------------------------------*/
+            /* USER MESSAGE                                                                                           */
+            /*--------------------------------------------------------------------------------------------------------*/
+
+            /* The JSON command payload is parsed in situ below, the user handler has to see it first. */
+
+            if(node->user_mqtt_handler != NULL)
+            {
+                node->user_mqtt_handler(
+                    node,
+                    NYX_NODE_EVENT_MSG,
+                    event_topic.len,
+                    event_topic.buf,
+                    event_payload.len,
+                    event_payload.buf
+                );
+            }
+
             /*--------------------------------------------------------------------------------------------------------*/
             /* SPECIAL MESSAGES                                                                                       */
             /*--------------------------------------------------------------------------------------------------------*/
@@ -847,11 +1181,15 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
                         /* JSON NEW XXX VECTOR                                                                        */
                         /*--------------------------------------------------------------------------------------------*/
 
-                        nyx_object_t *object = nyx_object_parse_buff(event_payload.len, event_payload.buf);
+                        nyx_arena_t *arena = internal_arena_begin();
+
+                        nyx_object_t *object = internal_object_parse_buff_in_situ(event_payload.len, event_payload.buf);
+
+                        internal_arena_end(arena, object);
 
                         if(object != NULL)
                         {
-                            _process_message(node, object);
+                            _process_message(node, object, NULL);
 
                             nyx_object_unref(object);
                         }
@@ -866,20 +1204,17 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
                         #if !defined(ARDUINO)
                         /*--------------------------------------------------------------------------------------------*/
 
-                        nyx_xmldoc_t *xmldoc = nyx_xmldoc_parse_buff(event_payload.len, event_payload.buf);
+                        nyx_arena_t *arena = internal_arena_begin();
 
-                        if(xmldoc != NULL)
-                        {
-                            nyx_object_t *object = nyx_xmldoc_to_object(xmldoc);
+                        nyx_object_t *object = nyx_xml_buff_to_object(event_payload.len, event_payload.buf);
 
-                            if(object != NULL)
-                            {
-                                _process_message(node, object);
+                        internal_arena_end(arena, object);
 
-                                nyx_object_unref(object);
-                            }
+                        if(object != NULL)
+                        {
+                            _process_message(node, object, NULL);
 
-                            nyx_xmldoc_free(xmldoc);
+                            nyx_object_unref(object);
                         }
 
                         /*--------------------------------------------------------------------------------------------*/
@@ -889,22 +1224,6 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
                 }
             }
 
-            /*--------------------------------------------------------------------------------------------------------*/
-            /* USER MESSAGE                                                                                           */
-            /*--------------------------------------------------------------------------------------------------------*/
-
-            if(node->user_mqtt_handler != NULL)
-            {
-                node->user_mqtt_handler(
-                    node,
-                    NYX_NODE_EVENT_MSG,
-                    event_topic.len,
-                    event_topic.buf,
-                    event_payload.len,
-                    event_payload.buf
-                );
-            }
-
             /*--------------------------------------------------------------------------------------------------------*/
         }
     }
@@ -914,6 +1233,37 @@ static void _mqtt_handler(nyx_node_t *node, nyx_event_type_t event_type, const n
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/* Vectors built by hand or parsed from JSON / XML carry their "<>" tag but no kind. */
+
+static nyx_vector_kind_t _vector_kind(__NYX_NULLABLE__ STR_t tag)
+{
+    if(tag == NULL) {
+        return NYX_VECTOR_KIND_NONE;
+    }
+    if(strcmp("defNumberVector", tag) == 0) {
+        return NYX_VECTOR_KIND_NUMBER;
+    }
+    if(strcmp("defTextVector", tag) == 0) {
+        return NYX_VECTOR_KIND_TEXT;
+    }
+    if(strcmp("defLightVector", tag) == 0) {
+        return NYX_VECTOR_KIND_LIGHT;
+    }
+    if(strcmp("defSwitchVector", tag) == 0) {
+        return NYX_VECTOR_KIND_SWITCH;
+    }
+    if(strcmp("defBLOBVector", tag) == 0) {
+        return NYX_VECTOR_KIND_BLOB;
+    }
+    if(strcmp("defStreamVector", tag) == 0) {
+        return NYX_VECTOR_KIND_STREAM;
+    }
+
+    return NYX_VECTOR_KIND_NONE;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 nyx_node_t *nyx_node_initialize(
     STR_t node_id,
     nyx_dict_t *vectors[],
@@ -948,11 +1298,11 @@ nyx_node_t *nyx_node_initialize(
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        nyx_dict_set_string(vector, "@client", nyx_string_dup(node_id), true);
+        nyx_dict_set_string(vector, NYX_ATOM(CLIENT), nyx_string_dup(node_id), true);
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        nyx_object_t *children = nyx_dict_get(vector, "children");
+        nyx_object_t *children = nyx_dict_get(vector, NYX_ATOM(CHILDREN));
 
         if(children != NULL && children->type == NYX_TYPE_LIST)
         {
@@ -968,6 +1318,13 @@ nyx_node_t *nyx_node_initialize(
 
         vector->base.node = node;
 
+        vector->node_idx = (uint32_t) (vector_ptr - vectors) + 1;
+
+        if(vector->kind == NYX_VECTOR_KIND_NONE)
+        {
+            vector->kind = _vector_kind(nyx_dict_get_string(vector, NYX_ATOM(TAG)));
+        }
+
         /*------------------------------------------------------------------------------------------------------------*/
     }
 
@@ -990,20 +1347,44 @@ nyx_node_t *nyx_node_initialize(
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    node->indi_url = _safe_dup(indi_url);
-    node->mqtt_url = _safe_dup(mqtt_url);
-    node->nss_url = _safe_dup(nss_url);
+    node->indi_url = _safe_dup(indi_url);
+    node->mqtt_url = _safe_dup(mqtt_url);
+    node->nss_url = _safe_dup(nss_url);
+
+    node->mqtt_username = _safe_dup(mqtt_username);
+    node->mqtt_password = _safe_dup(mqtt_password);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    node->enable_xml = enable_xml;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    node->stream_policy = NYX_STREAM_POLICY_DROP_NEWEST;
+
+    node->stream_low_watermark = NYX_STREAM_LOW_WATERMARK;
+    node->stream_high_watermark = NYX_STREAM_HIGH_WATERMARK;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    node->vectors = vectors;
 
-    node->mqtt_username = _safe_dup(mqtt_username);
-    node->mqtt_password = _safe_dup(mqtt_password);
+    node->index = nyx_memory_alloc(sizeof(nyx_index_t));
+
+    _index_build(node->index, vectors);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    node->enable_xml = enable_xml;
+    size_t nb_vectors = 0;
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+    for(nyx_dict_t **vector_ptr = vectors; *vector_ptr != NULL; vector_ptr++, nb_vectors++) { /* NOSONAR */ }
 
-    node->vectors = vectors;
+    node->coalesce_notify = false;
+    node->pack_notify = false;
+
+    node->pending_vectors = memset(nyx_memory_alloc((nb_vectors + 1) * sizeof(nyx_dict_t *)), 0x00, (nb_vectors + 1) * sizeof(nyx_dict_t *));
+
+    node->rate_limits = NULL;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -1049,6 +1430,18 @@ void nyx_node_finalize(nyx_node_t *node, bool free_vectors)
             }
         }
 
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* FREE INDEX                                                                                                 */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        _index_clear(node->index);
+
+        nyx_memory_free(node->index);
+
+        nyx_memory_free(node->pending_vectors);
+
+        nyx_memory_free(node->rate_limits);
+
         /*------------------------------------------------------------------------------------------------------------*/
         /* FREE NODE                                                                                                  */
         /*------------------------------------------------------------------------------------------------------------*/
@@ -1087,64 +1480,241 @@ void nyx_node_ping(const nyx_node_t *node)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool internal_notify(const nyx_object_t *object)
+static __NYX_NULLABLE__ nyx_dict_t *_set_vector_new(const nyx_dict_t *vector)
 {
-    if(object->node != NULL && object->type == NYX_TYPE_DICT && (object->flags & NYX_FLAGS_DISABLED) == 0)
+    switch(vector->kind)
     {
-        const nyx_dict_t *vector = (nyx_dict_t *) object;
+        case NYX_VECTOR_KIND_NUMBER:
+            return nyx_number_set_vector_new(vector);
+
+        case NYX_VECTOR_KIND_TEXT:
+            return nyx_text_set_vector_new(vector);
+
+        case NYX_VECTOR_KIND_LIGHT:
+            return nyx_light_set_vector_new(vector);
+
+        case NYX_VECTOR_KIND_SWITCH:
+            return nyx_switch_set_vector_new(vector);
+
+        case NYX_VECTOR_KIND_STREAM:
+            return nyx_stream_set_vector_new(vector);
+
+        case NYX_VECTOR_KIND_BLOB:
+            return (vector->base.flags & NYX_FLAGS_BLOB_MASK) != 0 ? nyx_blob_set_vector_new(vector) : NULL;
+
+        default:
+            return NULL;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-        STR_t tag = nyx_dict_get_string(vector, "<>");
+/* The next setXXXVector only carries the properties modified after this one, see internal_prop_to_set_vector(). */
 
-        if(tag != NULL)
+static void _clear_dirty(const nyx_dict_t *vector)
+{
+    size_t idx;
+
+    nyx_object_t *object;
+
+    nyx_object_t *list = nyx_dict_get(vector, NYX_ATOM(CHILDREN));
+
+    if(list != NULL && list->type == NYX_TYPE_LIST)
+    {
+        for(nyx_list_iter_t iter = NYX_LIST_ITER(list); nyx_list_iterate(&iter, &idx, &object);)
+        {
+            object->flags &= ~NYX_FLAGS_DIRTY;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _notify(const nyx_node_t *node, const nyx_dict_t *vector, __NYX_NULLABLE__ nyx_string_builder_t *xml_sb, __NYX_NULLABLE__ nyx_string_builder_t *json_sb)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *set_vector = _set_vector_new(vector);
+
+    if(set_vector == NULL)
+    {
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    STR_t perm = nyx_dict_get_string(vector, NYX_ATOM(PERM));
+
+    bool is_not_wo = perm == NULL || strcmp(perm, "wo") != 0;
+
+    if(is_not_wo)
+    {
+        if(json_sb == NULL)
+        {
+            _sub_object(node, (nyx_object_t *) set_vector);
+        }
+        else
         {
             /*--------------------------------------------------------------------------------------------------------*/
+            #if !defined(ARDUINO)
+            /*--------------------------------------------------------------------------------------------------------*/
 
-            nyx_dict_t *set_vector;
+            if(xml_sb != NULL)
+            {
+                str_t xml = nyx_object_to_xml_string((nyx_object_t *) set_vector);
 
-            /**/ if(strcmp("defNumberVector", tag) == 0) {
-                set_vector = nyx_number_set_vector_new(vector);
-            }
-            else if(strcmp("defTextVector", tag) == 0) {
-                set_vector = nyx_text_set_vector_new(vector);
-            }
-            else if(strcmp("defLightVector", tag) == 0) {
-                set_vector = nyx_light_set_vector_new(vector);
-            }
-            else if(strcmp("defSwitchVector", tag) == 0) {
-                set_vector = nyx_switch_set_vector_new(vector);
-            }
-            else if(strcmp("defStreamVector", tag) == 0) {
-                set_vector = nyx_stream_set_vector_new(vector);
+                nyx_string_builder_append(xml_sb, NYX_SB_NO_ESCAPE, xml);
+
+                nyx_memory_free(xml);
             }
-            else if(strcmp("defBLOBVector", tag) == 0) {
 
-                if((vector->base.flags & NYX_FLAGS_BLOB_MASK) != 0) {
+            /*--------------------------------------------------------------------------------------------------------*/
+            #endif
+            /*--------------------------------------------------------------------------------------------------------*/
 
-                    set_vector = nyx_blob_set_vector_new(vector);
-                }
-                else {
-                    return false;
-                }
-            }
-            else {
-                return false;
+            str_t json = nyx_object_to_string((nyx_object_t *) set_vector);
+
+            nyx_string_builder_append(json_sb, NYX_SB_NO_ESCAPE, nyx_string_builder_length(json_sb) == 0 ? "[" : ",", json);
+
+            nyx_memory_free(json);
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_object_unref(&set_vector->base);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    _clear_dirty(vector);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _publish(const nyx_node_t *node, const nyx_dict_t *vector)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(node->coalesce_notify)
+    {
+        /* The vector is published once by internal_notify_flush(), with all its modifications at once. */
+
+        nyx_dict_t **pending_ptr = node->pending_vectors;
+
+        for(; *pending_ptr != NULL; pending_ptr++)
+        {
+            if(*pending_ptr == vector)
+            {
+                return true;
             }
+        }
 
-            /*--------------------------------------------------------------------------------------------------------*/
+        pending_ptr[0] = (nyx_dict_t *) vector;
+        pending_ptr[1] = NULL;
+
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return _notify(node, vector, NULL, NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _rate_limit_check(const nyx_node_t *node, const nyx_dict_t *vector)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_rate_limit_t *rate_limit = &node->rate_limits[vector->node_idx - 1];
+
+    if(rate_limit->interval_ms == 0)
+    {
+        return true;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    uint32_t now = (uint32_t) internal_get_millis();
+
+    if((uint32_t) (now - rate_limit->last_ms) < rate_limit->interval_ms)
+    {
+        /* Held back, the latest state is published by _rate_limit_timer_handler() when the window elapses. */
+
+        rate_limit->pending = true;
+
+        return false;
+    }
+
+    rate_limit->pending = false;
+
+    rate_limit->last_ms = now;
+
+    return true;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _rate_limit_timer_handler(void *arg)
+{
+    const nyx_node_t *node = (const nyx_node_t *) arg;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
 
-            STR_t perm = nyx_dict_get_string(vector, "@perm");
+    uint32_t now = (uint32_t) internal_get_millis();
 
-            bool is_not_wo = perm == NULL || strcmp(perm, "wo") != 0;
+    for(size_t i = 0; node->vectors[i] != NULL; i++)
+    {
+        nyx_rate_limit_t *rate_limit = &node->rate_limits[i];
+
+        if(rate_limit->pending && (uint32_t) (now - rate_limit->last_ms) >= rate_limit->interval_ms)
+        {
+            /*--------------------------------------------------------------------------------------------------------*/
 
-            if(is_not_wo) _sub_object(object->node, (nyx_object_t *) set_vector);
+            rate_limit->pending = false;
+
+            rate_limit->last_ms = now;
 
             /*--------------------------------------------------------------------------------------------------------*/
 
-            nyx_object_unref(&set_vector->base);
+            const nyx_dict_t *vector = node->vectors[i];
+
+            if((vector->base.flags & NYX_FLAGS_DISABLED) == 0)
+            {
+                _publish(node, vector);
+            }
 
             /*--------------------------------------------------------------------------------------------------------*/
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_notify(const nyx_object_t *object)
+{
+    if(object->node != NULL && object->type == NYX_TYPE_DICT && (object->flags & NYX_FLAGS_DISABLED) == 0)
+    {
+        const nyx_dict_t *vector = (nyx_dict_t *) object;
+
+        if(vector->kind != NYX_VECTOR_KIND_NONE)
+        {
+            if(object->node->rate_limits != NULL && vector->node_idx != 0 && !_rate_limit_check(object->node, vector))
+            {
+                return true;
+            }
 
-            return true;
+            return _publish(object->node, vector);
         }
     }
 
@@ -1153,7 +1723,72 @@ bool internal_notify(const nyx_object_t *object)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static void _device_onoff(const nyx_node_t *node, STR_t device, STR_t name, STR_t message, nyx_onoff_t onoff)
+void internal_notify_flush(const nyx_node_t *node)
+{
+    if(node->pending_vectors[0] == NULL)
+    {
+        return;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_string_builder_t *xml_sb = node->pack_notify && node->enable_xml ? nyx_string_builder_new() : NULL;
+    nyx_string_builder_t *json_sb = node->pack_notify /*-------------*/ ? nyx_string_builder_new() : NULL;
+
+    for(nyx_dict_t **pending_ptr = node->pending_vectors; *pending_ptr != NULL; pending_ptr++)
+    {
+        if(((*pending_ptr)->base.flags & NYX_FLAGS_DISABLED) == 0)
+        {
+            _notify(node, *pending_ptr, xml_sb, json_sb);
+        }
+    }
+
+    node->pending_vectors[0] = NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(json_sb != NULL)
+    {
+        if(nyx_string_builder_length(json_sb) > 0)
+        {
+            nyx_string_builder_append(json_sb, NYX_SB_NO_ESCAPE, "]");
+
+            str_t xml = xml_sb != NULL ? nyx_string_builder_to_string(xml_sb) : NULL;
+            str_t json = /*---------------*/ nyx_string_builder_to_string(json_sb);
+
+            _sub_batch(node, xml, json);
+
+            nyx_memory_free(json);
+            nyx_memory_free(xml);
+        }
+
+        nyx_string_builder_free(json_sb);
+
+        if(xml_sb != NULL)
+        {
+            nyx_string_builder_free(xml_sb);
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_node_set_notify_coalescing(nyx_node_t *node, bool coalesce, bool pack)
+{
+    if(!coalesce)
+    {
+        internal_notify_flush(node);
+    }
+
+    node->coalesce_notify = coalesce;
+    node->pack_notify = pack;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_node_set_publish_rate(nyx_node_t *node, STR_t device, STR_t name, double max_rate)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -1161,31 +1796,99 @@ static void _device_onoff(const nyx_node_t *node, STR_t device, STR_t name, STR_
     {
         /*------------------------------------------------------------------------------------------------------------*/
 
-        for(nyx_dict_t **vector_ptr = node->vectors; *vector_ptr != NULL; vector_ptr++)
+        if(node->rate_limits == NULL)
         {
-            nyx_dict_t *vector = *vector_ptr;
+            size_t nb_vectors = 0;
 
-            /*--------------------------------------------------------------------------------------------------------*/
+            for(nyx_dict_t **vector_ptr = node->vectors; *vector_ptr != NULL; vector_ptr++, nb_vectors++) { /* NOSONAR */ }
+
+            node->rate_limits = memset(nyx_memory_alloc((nb_vectors + 1) * sizeof(nyx_rate_limit_t)), 0x00, (nb_vectors + 1) * sizeof(nyx_rate_limit_t));
+
+            nyx_node_add_timer(node, NYX_RATE_LIMIT_TICK_MS, _rate_limit_timer_handler, node);
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        /* Rounded up so that the limit is never exceeded, and at least 1 ms as the clock has a millisecond resolution. */
+
+        uint32_t interval_ms;
+
+        /**/ if(max_rate <= 0.0)
+        {
+            interval_ms = 0;
+        }
+        else if(max_rate >= 1000.0)
+        {
+            interval_ms = 1;
+        }
+        else if(max_rate <= 1000.0 / (double) UINT32_MAX)
+        {
+            interval_ms = UINT32_MAX;
+        }
+        else
+        {
+            double interval = 1000.0 / max_rate;
+
+            interval_ms = (uint32_t) interval;
+
+            if((double) interval_ms < interval)
+            {
+                interval_ms++;
+            }
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uint32_t now = (uint32_t) internal_get_millis();
 
-            STR_t device2 = nyx_dict_get_string(vector, "@device");
-            STR_t name2 = nyx_dict_get_string(vector, "@name");
+        nyx_dict_t *vector;
 
+        for(nyx_index_iter_t index_iter = _index_iter(node, device, name, false); (vector = _index_next(node, &index_iter)) != NULL;)
+        {
             /*--------------------------------------------------------------------------------------------------------*/
 
-            if(device2 == NULL || strcmp(device, device2) != 0)
+            nyx_rate_limit_t *rate_limit = &node->rate_limits[vector->node_idx - 1];
+
+            /* The first notification after enabling the limit goes through. */
+
+            if(rate_limit->interval_ms == 0)
             {
-                continue;
+                rate_limit->last_ms = now - interval_ms;
             }
 
-            if(name != NULL)
+            rate_limit->interval_ms = interval_ms;
+
+            if(interval_ms == 0 && rate_limit->pending)
             {
-                if(name2 == NULL || strcmp(name, name2) != 0)
-                {
-                    continue;
-                }
+                rate_limit->pending = false;
+
+                nyx_object_notify(&vector->base);
             }
 
             /*--------------------------------------------------------------------------------------------------------*/
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _device_onoff(const nyx_node_t *node, STR_t device, STR_t name, STR_t message, nyx_onoff_t onoff)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(node != NULL && device != NULL)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        nyx_dict_t *vector;
+
+        for(nyx_index_iter_t index_iter = _index_iter(node, device, name, false); (vector = _index_next(node, &index_iter)) != NULL;)
+        {
+            /*--------------------------------------------------------------------------------------------------------*/
 
             switch(onoff)
             {
@@ -1196,7 +1899,7 @@ static void _device_onoff(const nyx_node_t *node, STR_t device, STR_t name, STR_
                 case NYX_ONOFF_ON:
                     vector->base.flags &= ~NYX_FLAGS_DISABLED;
 
-                    _sub_object(node, (nyx_object_t *) vector);
+                    _sub_vector(node, vector, NULL);
                     break;
             }
 
@@ -12,8 +12,15 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-void nyx_nss_pub(const nyx_node_t *node, STR_t device, STR_t stream, size_t n_fields, const uint32_t field_hashes[], const size_t field_sizes[], const buff_t field_buffs[])
+bool nyx_nss_pub(const nyx_node_t *node, STR_t device, STR_t stream, size_t n_fields, const uint32_t field_hashes[], const size_t field_sizes[], const buff_t field_buffs[])
 {
+    if(n_fields > NYX_STREAM_MAX_FIELDS)
+    {
+        NYX_LOG_ERROR("Too many stream fields, %d at most", NYX_STREAM_MAX_FIELDS);
+
+        return false;
+    }
+
     if(n_fields > 0)
     {
         /*------------------------------------------------------------------------------------------------------------*/
@@ -40,30 +47,59 @@ void nyx_nss_pub(const nyx_node_t *node, STR_t device, STR_t stream, size_t n_fi
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        uint32_t header1[3] = {
-            NYX_STREAM_MAGIC,
-            path_hash,
-            size,
-        };
+        /* Headers are laid out in a single stack buffer of bounded size, payloads are referenced in place. */
+
+        uint32_t headers[3 + 2 * NYX_STREAM_MAX_FIELDS];
+
+        nyx_str_t messages[1 + 2 * NYX_STREAM_MAX_FIELDS];
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        headers[0] = NYX_STREAM_MAGIC;
+        headers[1] = path_hash;
+        headers[2] = size;
 
-        internal_stream_pub(node, NYX_STR_S(buffof(header1), sizeof(header1)));
+        messages[0] = NYX_STR_S(buffof(headers + 0), 3 * sizeof(uint32_t));
 
         /*------------------------------------------------------------------------------------------------------------*/
 
         for(size_t i = 0; i < n_fields; i++)
         {
-            uint32_t header2[2] = {
-                field_hashes[i] & 0xFFFFFFFFLU,
-                field_sizes[i] & 0xFFFFFFFFLU,
-            };
+            uint32_t *header2 = headers + 3 + 2 * i;
 
-            internal_stream_pub(node, NYX_STR_S(buffof(header2), sizeof(header2)));
+            header2[0] = field_hashes[i] & 0xFFFFFFFFLU;
+            header2[1] = field_sizes[i] & 0xFFFFFFFFLU;
 
-            internal_stream_pub(node, NYX_STR_S(field_buffs[i], field_sizes[i]));
+            messages[1 + 2 * i] = NYX_STR_S(buffof(header2), 2 * sizeof(uint32_t));
+
+            messages[2 + 2 * i] = NYX_STR_S(field_buffs[i], field_sizes[i]);
         }
 
         /*------------------------------------------------------------------------------------------------------------*/
+
+        return internal_stream_pubv(node, 1 + 2 * n_fields, messages);
     }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_node_set_stream_policy(nyx_node_t *node, nyx_stream_policy_t policy, size_t low_watermark, size_t high_watermark)
+{
+    if(low_watermark > high_watermark)
+    {
+        NYX_LOG_ERROR("Low watermark must not exceed high watermark");
+
+        return false;
+    }
+
+    node->stream_policy = policy;
+
+    node->stream_low_watermark = low_watermark;
+    node->stream_high_watermark = high_watermark;
+
+    return true;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -77,8 +77,55 @@ double nan(const char *tag);
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Memory allocator used by the memory primitives.
+ */
+
+typedef struct
+{
+    buff_t (* alloc)(
+        __NYX_NULLABLE__ void *ctx,                                                             //!< Allocator context.
+        size_t size                                                                             //!< Size of the block.
+    );                                                                                          //!< Similar to libc malloc.
+
+    buff_t (* realloc)(
+        __NYX_NULLABLE__ void *ctx,                                                             //!< Allocator context.
+        buff_t buff,                                                                            //!< Block to resize.
+        size_t size                                                                             //!< New size of the block.
+    );                                                                                          //!< Similar to libc realloc.
+
+    void (* free)(
+        __NYX_NULLABLE__ void *ctx,                                                             //!< Allocator context.
+        buff_t buff                                                                             //!< Block to free.
+    );                                                                                          //!< Similar to libc free.
+
+    __NYX_NULLABLE__ size_t (* usable_size)(
+        __NYX_NULLABLE__ void *ctx,                                                             //!< Allocator context.
+        BUFF_t buff                                                                             //!< Allocated block.
+    );                                                                                          //!< Similar to malloc_usable_size, optional, only used by realloc.
+
+    __NYX_NULLABLE__ void *ctx;                                                                 //!< Context pointer passed to the callbacks.
+
+} nyx_allocator_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Sets the memory allocator, e.g. mimalloc, jemalloc or TLSF.
+ * @param allocator The new allocator, `NULL` to restore the libc one.
+ * @return `true` on success, `false` if the allocator is invalid or if memory is still in use.
+ * @note Must be called before any allocation, typically before @ref nyx_memory_initialize. With memory accounting (`NYX_MEMORY_STATS=1`), each block is prefixed with a `max_align_t` aligned header holding its size and category. The optional `usable_size` callback is only queried on reallocation, to grow a block in place when it already has room. Without accounting, heap blocks still in use cannot be detected.
+ */
+
+bool nyx_memory_set_allocator(
+    __NYX_NULLABLE__ const nyx_allocator_t *allocator
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief Initializes the memory subsystem.
+ * @note Also selects the base64 implementation for the CPU, must be called before other threads are started.
  */
 
 void nyx_memory_initialize(void);
@@ -125,6 +172,92 @@ __NYX_NULLABLE__ buff_t nyx_memory_realloc(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Memory categories used for accounting.
+ */
+
+typedef enum
+{
+    NYX_MEMORY_CATEGORY_OTHER = 1000,                                                           //!< Uncategorized memory.
+    NYX_MEMORY_CATEGORY_OBJECT = 1001,                                                          //!< Nyx objects, dict and list storage.
+    NYX_MEMORY_CATEGORY_STRING = 1002,                                                          //!< Duplicated strings and buffers.
+    NYX_MEMORY_CATEGORY_BUILDER = 1003,                                                         //!< String builders.
+    NYX_MEMORY_CATEGORY_DOM = 1004,                                                             //!< XML DOM nodes.
+    NYX_MEMORY_CATEGORY_STREAM = 1005,                                                          //!< Stream frame buffers.
+    NYX_MEMORY_CATEGORY_BLOB = 1006,                                                            //!< Base64 and compressed BLOBs.
+
+} nyx_memory_category_t;
+
+#define NYX_MEMORY_CATEGORY_NB 7                                                                //!< Number of memory categories.
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Memory statistics of a category.
+ */
+
+typedef struct
+{
+    size_t current;                                                                             //!< Memory currently allocated.
+    size_t peak;                                                                                //!< High-water mark of `current`.
+    size_t count;                                                                               //!< Number of allocations since initialization.
+
+} nyx_memory_category_stats_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Memory statistics.
+ */
+
+typedef struct
+{
+    nyx_memory_category_stats_t categories[NYX_MEMORY_CATEGORY_NB];                            //!< Statistics per category, indexed by `category - NYX_MEMORY_CATEGORY_OTHER`.
+    nyx_memory_category_stats_t total;                                                          //!< Statistics of all categories.
+
+} nyx_memory_stats_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Gets the memory statistics.
+ * @param stats Output statistics, zeroed when accounting is disabled (`NYX_MEMORY_STATS=0`).
+ * @note Counters are kept per thread and summed up on demand, peaks are therefore exact for a single thread and an upper bound otherwise.
+ */
+
+void nyx_memory_stats(
+    nyx_memory_stats_t *stats
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Statistics of the small object pools.
+ */
+
+typedef struct
+{
+    size_t slab_count;                                                                          //!< Number of slabs carved into chunks.
+    size_t slab_bytes;                                                                          //!< Memory reserved by these slabs.
+    size_t used_chunks;                                                                         //!< Number of chunks currently in use.
+    size_t used_bytes;                                                                          //!< Memory of the chunks currently in use.
+    size_t free_chunks;                                                                         //!< Number of chunks available for reuse.
+
+} nyx_memory_pool_stats_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Gets the statistics of the small object pools.
+ * @param stats Output statistics, zeroed when the pools are disabled (`NYX_MEMORY_POOL=0`).
+ */
+
+void nyx_memory_pool_stats(
+    nyx_memory_pool_stats_t *stats
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief Similar to libc strdup.
  */
@@ -322,6 +455,35 @@ __NYX_NULLABLE__ str_t nyx_base64_encode(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Returns the length of the Base64 encoding of a buffer, without the null terminator.
+ * \param size Size of the buffer to encode.
+ * \return The length of the encoded string.
+ */
+
+__NYX_INLINE__ size_t nyx_base64_encoded_len(size_t size)
+{
+    return 4 * ((size + 2) / 3);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Encodes a buffer using the Base64 algorithm into a caller-provided string.
+ * \param result_str Destination string of at least `nyx_base64_encoded_len(size) + 1` bytes.
+ * \param size Size of the buffer to encode.
+ * \param buff Pointer to the buffer to encode.
+ * \return The length of the encoded string.
+ */
+
+size_t nyx_base64_encode_to(
+    __NYX_NOTNULL__ str_t result_str,
+    __NYX_ZEROABLE__ size_t size,
+    __NYX_NULLABLE__ BUFF_t buff
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief Decodes a string using the Base64 algorithm.
  * \param result_size Optional pointer to store the size of the decoded buffer.
@@ -338,6 +500,35 @@ __NYX_NULLABLE__ buff_t nyx_base64_decode(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Returns an upper bound of the size of a decoded Base64 string, without the null terminator.
+ * \param len Length of the string to decode.
+ * \return The maximum size of the decoded buffer.
+ */
+
+__NYX_INLINE__ size_t nyx_base64_decoded_size(size_t len)
+{
+    return 3 * (len / 4);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Decodes a string using the Base64 algorithm into a caller-provided buffer.
+ * \param result_buff Destination buffer of at least `nyx_base64_decoded_size(len) + 1` bytes.
+ * \param len Length of the string to decode.
+ * \param str Pointer to the string to decode.
+ * \return The size of the decoded buffer.
+ */
+
+size_t nyx_base64_decode_to(
+    __NYX_NOTNULL__ buff_t result_buff,
+    __NYX_ZEROABLE__ size_t len,
+    __NYX_NULLABLE__ STR_t str
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief Compresses a buffer using the ZLib algorithm.
  * \param result_size Optional pointer to store the size of the compressed buffer.
@@ -400,6 +591,141 @@ __NYX_NULLABLE__ buff_t nyx_zlib_base64_inflate(
     __NYX_NULLABLE__ STR_t str
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief ZLib compression strategy.
+ */
+
+typedef enum
+{
+    NYX_ZLIB_STRATEGY_DEFAULT = 800,                                                            //!< Default strategy.
+    NYX_ZLIB_STRATEGY_FILTERED = 801,                                                           //!< Tuned for filtered data (e.g. images).
+    NYX_ZLIB_STRATEGY_HUFFMAN_ONLY = 802,                                                       //!< Huffman coding only, fastest.
+    NYX_ZLIB_STRATEGY_RLE = 803,                                                                //!< Run-length encoding only.
+    NYX_ZLIB_STRATEGY_FIXED = 804,                                                              //!< Fixed Huffman codes.
+
+} nyx_zlib_strategy_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @struct nyx_zlib_stream_t
+ * @brief Opaque struct describing a streaming ZLib context.
+ */
+
+typedef struct nyx_zlib_stream_s nyx_zlib_stream_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Streaming ZLib output handler, called every time a chunk of output is available.
+ * @param ctx User context pointer.
+ * @param size Number of output bytes.
+ * @param buff Output buffer, only valid during the call.
+ */
+
+typedef void (* nyx_zlib_sink_t)(
+    __NYX_NULLABLE__ void *ctx,
+    size_t size,
+    BUFF_t buff
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Allocates a new streaming ZLib compressor.
+ * @param level Compression level, from 0 (none) to 9 (best), -1 for the default one.
+ * @param strategy Compression strategy.
+ * @param base64 If `true`, the output is Base64-encoded on the fly.
+ * @param sink Output handler.
+ * @param ctx User context pointer passed to the output handler.
+ * @return The new streaming ZLib compressor.
+ * @note Without ZLib support, the data are emitted as stored (uncompressed) deflate blocks.
+ */
+
+__NYX_NULLABLE__ nyx_zlib_stream_t *nyx_zlib_deflate_new(
+    int level,
+    nyx_zlib_strategy_t strategy,
+    bool base64,
+    __NYX_NOTNULL__ nyx_zlib_sink_t sink,
+    __NYX_NULLABLE__ void *ctx
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Compresses a chunk of data.
+ * @param stream Streaming ZLib compressor.
+ * @param size Size of the buffer to compress.
+ * @param buff Pointer to the buffer to compress.
+ * @param flush If `true`, all pending output is emitted, at the cost of a lower compression ratio.
+ * @return `true` on success, `false` otherwise.
+ */
+
+bool nyx_zlib_deflate_push(
+    __NYX_NOTNULL__ nyx_zlib_stream_t *stream,
+    __NYX_ZEROABLE__ size_t size,
+    __NYX_NULLABLE__ BUFF_t buff,
+    bool flush
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Terminates the compressed stream, emits the remaining output and releases the compressor.
+ * @param stream Streaming ZLib compressor.
+ * @return `true` on success, `false` otherwise.
+ */
+
+bool nyx_zlib_deflate_end(
+    __NYX_NOTNULL__ nyx_zlib_stream_t *stream
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Allocates a new streaming ZLib decompressor.
+ * @param base64 If `true`, the input is Base64-decoded on the fly.
+ * @param sink Output handler.
+ * @param ctx User context pointer passed to the output handler.
+ * @return The new streaming ZLib decompressor, `NULL` without ZLib support.
+ */
+
+__NYX_NULLABLE__ nyx_zlib_stream_t *nyx_zlib_inflate_new(
+    bool base64,
+    __NYX_NOTNULL__ nyx_zlib_sink_t sink,
+    __NYX_NULLABLE__ void *ctx
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Decompresses a chunk of data.
+ * @param stream Streaming ZLib decompressor.
+ * @param size Size of the buffer to decompress.
+ * @param buff Pointer to the buffer to decompress.
+ * @return `true` on success, `false` otherwise.
+ */
+
+bool nyx_zlib_inflate_push(
+    __NYX_NOTNULL__ nyx_zlib_stream_t *stream,
+    __NYX_ZEROABLE__ size_t size,
+    __NYX_NULLABLE__ BUFF_t buff
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Releases the decompressor.
+ * @param stream Streaming ZLib decompressor.
+ * @return `true` if the whole compressed stream was decoded, `false` otherwise.
+ */
+
+bool nyx_zlib_inflate_end(
+    __NYX_NOTNULL__ nyx_zlib_stream_t *stream
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* OBJECT                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -417,6 +743,9 @@ __NYX_NULLABLE__ buff_t nyx_zlib_base64_inflate(
 #define NYX_FLAGS_DISABLED    UINT64_C(0x0000000000000001)                                      // Flag indicating that the object is disabled.
     /* 0b0000000000000000000000000000000_0000000000000000000000000000000_01 */
 
+#define NYX_FLAGS_DIRTY       UINT64_C(0x0000000000000002)                                      // Flag indicating that an entry of the object has been modified.
+    /* 0b0000000000000000000000000000000_0000000000000000000000000000000_10 */
+
 #define NYX_FLAGS_BLOB_MASK   UINT64_C(0x00000001FFFFFFFC)                                      // Mask indicating the Nyx blob emission per client.
     /* 0b0000000000000000000000000000000_1111111111111111111111111111111_00 */
 
@@ -462,6 +791,7 @@ typedef struct nyx_object_s
     nyx_type_t type;                                                                            //!< Type of object, see @ref nyx_type_t.
     uint64_t flags;                                                                             //!< Mask of flags, see NYX_FLAGS_XXX definitions.
     int32_t ref;                                                                                //!< Reference counter for memory allocation.
+    bool in_arena;                                                                              //!< Private, `true` if the object lives in a per-message arena.
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -626,6 +956,7 @@ bool nyx_object_notify(
  * @param object1 First JSON object.
  * @param object2 Second JSON object.
  * @return `true` if the objects are equal, `false` otherwise.
+ * @note Two NaN numbers are equal.
  */
 
 bool nyx_object_equal(
@@ -1088,6 +1419,24 @@ __NYX_INLINE__ nyx_string_t *nyx_string_from_buff(size_t size, BUFF_t buff, bool
   */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief INDI / Nyx vector kinds.
+ */
+
+typedef enum
+{
+    NYX_VECTOR_KIND_NONE = 1200,                                                                //!< Not an INDI / Nyx vector.
+    NYX_VECTOR_KIND_NUMBER = 1201,                                                              //!< Number vector.
+    NYX_VECTOR_KIND_TEXT = 1202,                                                                //!< Text vector.
+    NYX_VECTOR_KIND_LIGHT = 1203,                                                               //!< Light vector.
+    NYX_VECTOR_KIND_SWITCH = 1204,                                                              //!< Switch vector.
+    NYX_VECTOR_KIND_BLOB = 1205,                                                                //!< BLOB vector.
+    NYX_VECTOR_KIND_STREAM = 1206,                                                              //!< Stream vector.
+
+} nyx_vector_kind_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @struct nyx_dict_t
  * @brief Struct describing a JSON dict object.
@@ -1097,9 +1446,20 @@ typedef struct nyx_dict_s
 {
     nyx_object_t base;                                                                          //!< Common object header for JSON objects.
 
+    size_t size;                                                                                //!< Number of key/value entries.
+
+    size_t capacity;                                                                            //!< Number of hash table slots (zero when not indexed).
+    struct nyx_dict_node_s **table;                                                             //!< Open-addressing hash table of key/value entries.
+
     struct nyx_dict_node_s *head;                                                               //!< Linked list of key/value entries.
     struct nyx_dict_node_s *tail;                                                               //!< Linked list of key/value entries.
 
+    __NYX_NULLABLE__ struct nyx_dict_cache_s *cache;                                            //!< Serialized forms, kept until the next modification.
+
+    nyx_vector_kind_t kind;                                                                     //!< Kind of INDI / Nyx vector, derived from the "<>" tag when not set.
+
+    uint32_t node_idx;                                                                          //!< Private, position of the vector in its node plus one, zero if not attached.
+
 } nyx_dict_t;
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -1428,8 +1788,10 @@ typedef struct nyx_list_s
 {
     nyx_object_t base;                                                                          //!< Common object header for JSON objects.
 
-    struct nyx_list_node_s *head;                                                               //!< Linked list of key/value entries.
-    struct nyx_list_node_s *tail;                                                               //!< Linked list of key/value entries.
+    size_t size;                                                                                //!< Number of items.
+    size_t capacity;                                                                            //!< Number of allocated item slots.
+
+    nyx_object_t **items;                                                                       //!< Contiguous array of items.
 
 } nyx_list_t;
 
@@ -1443,7 +1805,7 @@ typedef struct
 {
     size_t idx;                                                                                 //!< Current zero-based iteration index.
 
-    struct nyx_list_node_s *head;                                                               //!< Next JSON object to visit.
+    const struct nyx_list_s *list;                                                              //!< JSON list being visited.
 
 } nyx_list_iter_t;
 
@@ -1455,7 +1817,7 @@ typedef struct
  */
 
 #define NYX_LIST_ITER(list) \
-                ((nyx_list_iter_t) {0, ((nyx_list_t *) (list))->head})
+                ((nyx_list_iter_t) {0, ((nyx_list_t *) (list))})
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
@@ -1879,6 +2241,21 @@ __NYX_NULLABLE__ nyx_object_t *nyx_xmldoc_to_object(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @brief Parses an XML Nyx / INDI command directly into the JSON one.
+ * @param size String size.
+ * @param buff String pointer.
+ * @return The corresponding JSON Nyx / INDI command.
+ * @note Equivalent to @ref nyx_xmldoc_parse_buff followed by @ref nyx_xmldoc_to_object, without building the intermediate XML document.
+ */
+
+__NYX_NULLABLE__ nyx_object_t *nyx_xml_buff_to_object(
+    __NYX_ZEROABLE__ size_t size,
+    __NYX_NULLABLE__ BUFF_t buff
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @brief Converts a JSON Nyx / INDI command to the XML one.
  * @param object JSON Nyx / INDI command.
@@ -1889,6 +2266,20 @@ __NYX_NULLABLE__ nyx_xmldoc_t *nyx_object_to_xmldoc(
     __NYX_NULLABLE__ const nyx_object_t *object
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Serializes a JSON Nyx / INDI command directly to an XML string.
+ * @param object JSON Nyx / INDI command.
+ * @return A newly allocated string that represents the corresponding XML Nyx / INDI command.
+ * @note Equivalent to @ref nyx_object_to_xmldoc followed by @ref nyx_xmldoc_to_string, without building the intermediate XML document.
+ * @note Must be freed with @ref nyx_memory_free.
+ */
+
+__NYX_NULLABLE__ str_t nyx_object_to_xml_string(
+    __NYX_NULLABLE__ const nyx_object_t *object
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 #endif
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -2737,11 +3128,12 @@ nyx_dict_t *nyx_stream_vector_new(
 /**
  * @brief If Nyx Stream is enabled, publishes an entry to a stream.
  * @param vector Nyx stream vector.
- * @param n_fields Number of fields. Must match the number of properties in the vector.
+ * @param n_fields Number of fields, at most 64 (`NYX_STREAM_MAX_FIELDS`). Must match the number of properties in the vector.
  * @param field_sizes Array of payload byte counts, one per field.
  * @param field_buffs Array of payload buffers, one per field.
- * @return `true` if the provided fields match the vector content, `false` otherwise.
+ * @return `true` if the frame was queued (or if the stream is not enabled), `false` if the provided fields do not match the vector content, if the frame was dropped by the backpressure policy or if Nyx Stream is not connected.
  * @note Field payloads may contain arbitrary binary data.
+ * @note Drivers may use a `false` return to slow down their acquisition rate, see @ref nyx_node_set_stream_policy.
  */
 
 bool nyx_stream_pub(
@@ -2842,7 +3234,7 @@ typedef enum
  * @param topic_buff MQTT topic buffer.
  * @param message_size Number of message payload bytes.
  * @param message_buff Message payload buffer.
- * @note The message payload may contain arbitrary binary data.
+ * @note The message payload may contain arbitrary binary data. The handler is invoked before the node processes the message, and must not modify the payload.
  */
 
 typedef void (* nyx_mqtt_handler_t)(
@@ -2938,6 +3330,42 @@ void nyx_node_poll(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/**
+ * @memberof nyx_node_t
+ * @brief Enables or disables the coalescing of vector notifications.
+ * @param node Nyx node.
+ * @param coalesce If `true`, modified vectors are queued instead of being published immediately.
+ * @param pack If `true`, the queued vectors are published as a single message.
+ * @note Queued vectors are flushed at the end of @ref nyx_node_poll, once per vector and with their latest state. When packed, they are published on `nyx/json/batch` as a JSON list and on `nyx/xml/batch` as concatenated XML messages, INDI clients receive the same XML stream. `nyx/json` and `nyx/xml` always carry a single message.
+ */
+
+void nyx_node_set_notify_coalescing(
+    nyx_node_t *node,
+    bool coalesce,
+    bool pack
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @memberof nyx_node_t
+ * @brief Limits the publication rate of a device or of a vector.
+ * @param node Nyx node.
+ * @param device Device name.
+ * @param name Vector name, if `NULL`, all the vectors of the device are concerned.
+ * @param max_rate Maximum publication rate [Hz], 0 to disable the limit.
+ * @note Notifications received within the window are held back, and the latest state of the vector is published by a node timer once the window elapses. The window is rounded up to the millisecond, rates above 1 kHz are therefore limited to 1 kHz.
+ */
+
+void nyx_node_set_publish_rate(
+    nyx_node_t *node,
+    STR_t device,
+    __NYX_NULLABLE__ STR_t name,
+    double max_rate
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /**
  * @memberof nyx_node_t
  * @brief Enables a device or a vector and notifies clients.
@@ -3054,16 +3482,17 @@ void nyx_mqtt_pub(
  * @param node Nyx node.
  * @param device Device name.
  * @param stream Stream name.
- * @param n_fields Number of fields.
+ * @param n_fields Number of fields, at most 64 (`NYX_STREAM_MAX_FIELDS`).
  * @param field_hashes Array of field name hashes, one per field.
  * @param field_sizes Array of payload byte counts, one per field.
  * @param field_buffs Array of payload buffers, one per field.
+ * @return `true` if the frame was sent or queued, `false` if there are too many fields, if it was dropped or if Nyx Stream is not connected.
  * @warning Field hashes must be computed with @ref nyx_hash.
  * @warning Unless performance is critical, prefer using @ref nyx_stream_pub.
  * @note Field payloads may contain arbitrary binary data.
  */
 
-void nyx_nss_pub(
+bool nyx_nss_pub(
     const nyx_node_t *node,
     STR_t device,
     STR_t stream,
@@ -3073,6 +3502,72 @@ void nyx_nss_pub(
     const buff_t field_buffs[]
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @memberof nyx_node_t
+ * @brief Nyx Stream backpressure policy, applied when the send buffer reaches its high watermark.
+ */
+
+typedef enum
+{
+    NYX_STREAM_POLICY_DROP_NEWEST = 900,                                                        //!< New frames are dropped until the buffer drains to the low watermark.
+    NYX_STREAM_POLICY_DROP_OLDEST = 901,                                                        //!< Unsent frames are dropped, oldest first, down to the low watermark.
+    NYX_STREAM_POLICY_BLOCK = 902,                                                              //!< The publisher waits until the buffer drains to the low watermark.
+
+} nyx_stream_policy_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @memberof nyx_node_t
+ * @brief Nyx Stream send statistics.
+ */
+
+typedef struct
+{
+    size_t queued_frames;                                                                       //!< Number of frames sent or queued.
+    size_t dropped_frames;                                                                      //!< Number of frames dropped by the backpressure policy.
+    size_t dropped_bytes;                                                                       //!< Number of bytes dropped by the backpressure policy.
+    size_t pending_bytes;                                                                       //!< Number of bytes currently waiting in the send buffer.
+
+} nyx_stream_stats_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @memberof nyx_node_t
+ * @brief Configures the Nyx Stream backpressure.
+ * @param node Nyx node.
+ * @param policy Policy applied once the send buffer reaches the high watermark.
+ * @param low_watermark Send buffer size [bytes] below which publishing resumes normally.
+ * @param high_watermark Send buffer size [bytes] above which the policy is applied.
+ * @return `true` on success, `false` if the watermarks are inconsistent.
+ * @note The default policy is @ref NYX_STREAM_POLICY_DROP_NEWEST with `NYX_STREAM_LOW_WATERMARK` and `NYX_STREAM_HIGH_WATERMARK`.
+ * @note If the connection cannot be flushed synchronously (e.g. TLS), @ref NYX_STREAM_POLICY_BLOCK behaves as @ref NYX_STREAM_POLICY_DROP_NEWEST.
+ */
+
+bool nyx_node_set_stream_policy(
+    nyx_node_t *node,
+    nyx_stream_policy_t policy,
+    size_t low_watermark,
+    size_t high_watermark
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @memberof nyx_node_t
+ * @brief Retrieves the Nyx Stream send statistics.
+ * @param node Nyx node.
+ * @param stats Output statistics.
+ */
+
+void nyx_node_stream_stats(
+    const nyx_node_t *node,
+    nyx_stream_stats_t *stats
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /** @} */
 /*--------------------------------------------------------------------------------------------------------------------*/
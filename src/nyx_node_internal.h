@@ -40,6 +40,126 @@ __NYX_NULLABLE__ str_t nyx_double_dup(
     double d
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef NYX_MEMORY_STATS
+#define NYX_MEMORY_STATS 1
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Same as nyx_memory_alloc() and nyx_memory_realloc() but accounted under the given category. A reallocated block  */
+/* keeps the category it was first allocated with.                                                                  */
+
+__NYX_NULLABLE__ buff_t nyx_memory_category_alloc(
+    nyx_memory_category_t category,
+    __NYX_ZEROABLE__ size_t size
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_NULLABLE__ buff_t nyx_memory_category_realloc(
+    nyx_memory_category_t category,
+    __NYX_NULLABLE__ buff_t buff,
+    __NYX_ZEROABLE__ size_t size
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef NYX_MEMORY_POOL
+#define NYX_MEMORY_POOL 1
+#endif
+
+#ifndef NYX_MEMORY_POOL_MAX_SIZE
+#define NYX_MEMORY_POOL_MAX_SIZE 128UL
+#endif
+
+#ifndef NYX_MEMORY_POOL_SLAB_SIZE
+#define NYX_MEMORY_POOL_SLAB_SIZE 4096UL
+#endif
+
+#ifndef NYX_MEMORY_POOL_STATIC_SIZE
+#define NYX_MEMORY_POOL_STATIC_SIZE 0UL
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Fixed-size objects up to NYX_MEMORY_POOL_MAX_SIZE bytes are served by per-size-class free lists. The slabs are    */
+/* taken from a static region of NYX_MEMORY_POOL_STATIC_SIZE bytes first, then from the heap. They are never given  */
+/* back before nyx_memory_finalize(), which keeps long-running nodes from fragmenting the heap.                      */
+
+buff_t nyx_memory_pool_alloc(
+    size_t size
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_memory_pool_free(
+    __NYX_NULLABLE__ buff_t buff,
+    size_t size
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef NYX_ARENA_BLOCK_SIZE
+#define NYX_ARENA_BLOCK_SIZE 4096UL
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct nyx_arena_s nyx_arena_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Until internal_arena_end(), allocations of the calling thread are served by a bump arena. The arena is released at */
+/* once when the root object is unreferenced, objects allocated in it must therefore not outlive this root object.  */
+/* Only the parsers run while an arena is current: objects created before must not be modified meanwhile.           */
+/*                                                                                                                  */
+/* Arena objects are read-only after internal_arena_end(), see internal_arena_frozen(): their setters fail instead  */
+/* of attaching heap memory that the release of the arena would leak. Deleting entries is allowed.                  */
+
+nyx_arena_t *internal_arena_begin(void);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void internal_arena_end(
+    nyx_arena_t *arena,
+    __NYX_NULLABLE__ nyx_object_t *root
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_arena_active(void);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_arena_frozen(
+    const nyx_object_t *object
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Variants of nyx_memory_free / nyx_memory_category_realloc / nyx_memory_pool_free for the storage of an object, */
+/* which may still belong to an arena after internal_arena_end() when the object does.                             */
+
+void internal_object_memory_free(
+    const nyx_object_t *owner,
+    __NYX_NULLABLE__ buff_t buff
+);
+
+buff_t internal_object_memory_realloc(
+    const nyx_object_t *owner,
+    nyx_memory_category_t category,
+    __NYX_NULLABLE__ buff_t buff,
+    size_t size
+);
+
+void internal_object_memory_pool_free(
+    const nyx_object_t *owner,
+    __NYX_NULLABLE__ buff_t buff,
+    size_t size
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* STRING                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -89,6 +209,29 @@ int nyx_unicode_to_utf8(
     uint32_t unicode_char
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* BASE64                                                                                                             */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    NYX_BASE64_IMPL_AUTO = 0,                                                                   //!< Fastest one supported by the CPU.
+    NYX_BASE64_IMPL_SCALAR = 1,                                                                 //!< Portable.
+    NYX_BASE64_IMPL_SSE41 = 2,                                                                  //!< x86 SSE4.1.
+    NYX_BASE64_IMPL_AVX2 = 3,                                                                   //!< x86 AVX2.
+    NYX_BASE64_IMPL_NEON = 4,                                                                   //!< AArch64 NEON.
+
+} nyx_base64_impl_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Called by nyx_memory_initialize(), before any other thread runs. Returns false if the implementation is not */
+/* compiled in or not supported by the CPU, the selection is then left unchanged.                              */
+
+bool internal_base64_select(
+    nyx_base64_impl_t impl
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* OBJECT                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -103,6 +246,7 @@ int nyx_unicode_to_utf8(
                 .type = (Type),                 \
                 .flags = 0,                     \
                 .ref = 1,                       \
+                .in_arena = false,              \
                 .node = NULL,                   \
                 .parent = NULL,                 \
                 .callback = {0},                \
@@ -111,6 +255,17 @@ int nyx_unicode_to_utf8(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/* A container is flagged dirty when one of its direct entries is modified, setXXXVector messages then only carry */
+/* the dirty properties, see internal_prop_to_set_vector(). The serialized forms cached by its ancestors are      */
+/* dropped at the same time.                                                                                      */
+
+bool internal_mark_dirty(
+    __NYX_NULLABLE__ nyx_object_t *object,
+    bool modified
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 void nyx_null_free(
     nyx_null_t *object
 );
@@ -135,16 +290,110 @@ void nyx_list_free(
     /*-*/ nyx_list_t *object
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+str_t internal_object_to_string(
+    const nyx_object_t *object,
+    bool cstring
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_NULLABLE__ nyx_object_t *internal_object_parse_buff_in_situ(
+    __NYX_ZEROABLE__ size_t size,
+    __NYX_NULLABLE__ buff_t buff
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* DICT                                                                                                               */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#ifndef NYX_DICT_INDEX_THRESHOLD
+#define NYX_DICT_INDEX_THRESHOLD 8
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Dict keys of the INDI vocabulary are interned: nodes point to the atom instead of holding a copy of the key. A    */
+/* lookup with NYX_ATOM(...) compares addresses only, any other key is still compared as a string.                  */
+
+typedef enum
+{
+    NYX_ATOM_CONTENT,                                                                           //!< `$`
+    NYX_ATOM_TAG,                                                                               //!< `<>`
+    NYX_ATOM_CLIENT,                                                                            //!< `@client`
+    NYX_ATOM_DEVICE,                                                                            //!< `@device`
+    NYX_ATOM_FORMAT,                                                                            //!< `@format`
+    NYX_ATOM_GROUP,                                                                             //!< `@group`
+    NYX_ATOM_HASH,                                                                              //!< `@hash`
+    NYX_ATOM_HINTS,                                                                             //!< `@hints`
+    NYX_ATOM_LABEL,                                                                             //!< `@label`
+    NYX_ATOM_MAX,                                                                               //!< `@max`
+    NYX_ATOM_MESSAGE,                                                                           //!< `@message`
+    NYX_ATOM_MIN,                                                                               //!< `@min`
+    NYX_ATOM_NAME,                                                                              //!< `@name`
+    NYX_ATOM_PERM,                                                                              //!< `@perm`
+    NYX_ATOM_RULE,                                                                              //!< `@rule`
+    NYX_ATOM_SIZE,                                                                              //!< `@size`
+    NYX_ATOM_STATE,                                                                             //!< `@state`
+    NYX_ATOM_STEP,                                                                              //!< `@step`
+    NYX_ATOM_TIMEOUT,                                                                           //!< `@timeout`
+    NYX_ATOM_TIMESTAMP,                                                                         //!< `@timestamp`
+    NYX_ATOM_CHILDREN,                                                                          //!< `children`
+    NYX_ATOM_NB,
+
+} nyx_atom_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define NYX_ATOM_WIDTH 16
+
+extern const char internal_atoms[NYX_ATOM_NB][NYX_ATOM_WIDTH];
+
+#define NYX_ATOM(name) \
+            ((STR_t) internal_atoms[NYX_ATOM_##name])
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct nyx_dict_cache_s
+{
+    __NYX_NULLABLE__ str_t json;
+    __NYX_NULLABLE__ str_t xml;
+
+} nyx_dict_cache_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Serialized forms are computed on first request and kept until the dict, or anything under it, is modified. The   */
+/* returned strings belong to the dict.                                                                             */
+
+STR_t internal_dict_to_cached_string(
+    nyx_dict_t *dict
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_NULLABLE__ STR_t internal_dict_to_cached_xml_string(
+    nyx_dict_t *dict
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void internal_dict_uncache(
+    nyx_dict_t *dict
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 typedef struct nyx_dict_node_s
 {
     STR_t key;
 
+    uint32_t hash;
+
     nyx_object_t *value;
 
+    struct nyx_dict_node_s *prev;
     struct nyx_dict_node_s *next;
 
 } nyx_dict_node_t;
@@ -178,20 +427,6 @@ bool nyx_dict_set_buff_unref(
     bool managed
 );
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* LIST                                                                                                               */
-/*--------------------------------------------------------------------------------------------------------------------*/
-
-typedef struct nyx_list_node_s
-{
-    /* idx */
-
-    nyx_object_t *value;
-
-    struct nyx_list_node_s *next;
-
-} nyx_list_node_t;
-
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* STRING BUILDER                                                                                                     */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -204,8 +439,10 @@ typedef struct nyx_list_node_s
 
 typedef struct
 {
-    struct nyx_string_builder_node_s *head;
-    struct nyx_string_builder_node_s *tail;
+    __NYX_NULLABLE__ str_t buff;
+
+    size_t len;
+    size_t capacity;
 
 } nyx_string_builder_t;
 
@@ -227,6 +464,19 @@ void nyx_string_builder_clear(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+void nyx_string_builder_reset(
+    /*-*/ nyx_string_builder_t *sb
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_string_builder_truncate(
+    /*-*/ nyx_string_builder_t *sb,
+    size_t len
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 void nyx_string_builder_append_n(
     /*-*/ nyx_string_builder_t *sb,
     uint32_t flags,
@@ -249,11 +499,6 @@ size_t nyx_string_builder_length(
     const nyx_string_builder_t *sb
 );
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-
-size_t nyx_string_builder_clength(
-    const nyx_string_builder_t *sb
-);
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
@@ -326,6 +571,15 @@ void nyx_xmldoc_add_attribute(
     __NYX_NULLABLE__ STR_t data
 );
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Strips the blanks and double quotes around a text content, returns its new start and updates its length. */
+
+STR_t internal_xml_trim(
+    STR_t s,
+    size_t *length
+);
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 #endif
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -510,6 +764,10 @@ nyx_blob_state_t nyx_str_to_blob_state(
 
 #define NYX_STREAM_MAGIC 0x5358594EU
 
+#ifndef NYX_STREAM_MAX_FIELDS
+#define NYX_STREAM_MAX_FIELDS 64
+#endif
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 typedef enum
@@ -539,24 +797,25 @@ nyx_stream_state_t nyx_str_to_stream_state(
 
 typedef struct
 {
-    struct tag_s *tag;
+    struct tag_s *tag;                      /* Tag of the message being framed, NULL while looking for one. */
 
-    STR_t s_ptr;
-    STR_t e_ptr;
+    STR_t s_ptr;                            /* Start of the last complete message. */
+    size_t len;                             /* Length of the last complete message. */
 
-    size_t pos;
-    size_t len;
+    size_t pos;                             /* Offset of the message being framed. */
+    size_t scan;                            /* Offset where scanning resumes. */
+    size_t done;                            /* Number of leading bytes no longer needed. */
 
 } nyx_xml_stream_t;
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 #define NYX_XML_STREAM() \
-            ((nyx_xml_stream_t) {.tag = NULL, .s_ptr = NULL, .e_ptr = NULL, .pos = 0, .len = 0})
+            ((nyx_xml_stream_t) {.tag = NULL, .s_ptr = NULL, .len = 0, .pos = 0, .scan = 0, .done = 0})
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool nyx_xml_stream_detect_opening_tag(
+bool nyx_xml_stream_next(
     nyx_xml_stream_t *xml_stream,
     size_t size,
     BUFF_t buff
@@ -564,10 +823,8 @@ bool nyx_xml_stream_detect_opening_tag(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool nyx_xml_stream_detect_closing_tag(
-    nyx_xml_stream_t *xml_stream,
-    size_t size,
-    BUFF_t buff
+size_t nyx_xml_stream_consume(
+    nyx_xml_stream_t *xml_stream
 );
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -578,6 +835,26 @@ bool nyx_xml_stream_detect_closing_tag(
 
 #define NYX_PING_MS 5000UL
 
+#ifndef NYX_INDI_MAX_QUEUE_SIZE
+#define NYX_INDI_MAX_QUEUE_SIZE (16UL * 1024UL * 1024UL)
+#endif
+
+#ifndef NYX_STREAM_LOW_WATERMARK
+#define NYX_STREAM_LOW_WATERMARK (1UL * 1024UL * 1024UL)
+#endif
+
+#ifndef NYX_STREAM_HIGH_WATERMARK
+#define NYX_STREAM_HIGH_WATERMARK (4UL * 1024UL * 1024UL)
+#endif
+
+#ifndef NYX_STREAM_BLOCK_TIMEOUT_MS
+#define NYX_STREAM_BLOCK_TIMEOUT_MS 1000UL
+#endif
+
+#ifndef NYX_RATE_LIMIT_TICK_MS
+#define NYX_RATE_LIMIT_TICK_MS 10UL
+#endif
+
 #define NYX_ALL "@ALL"
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -586,6 +863,40 @@ typedef struct nyx_stack_s nyx_stack_t;
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+typedef struct
+{
+    uint32_t hash;
+    uint32_t idx;                                   // index in `node->vectors` plus one, zero for an empty slot
+
+} nyx_index_slot_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct nyx_index_s
+{
+    size_t mask;
+
+    nyx_index_slot_t *vector_slots;                 // (device, name) -> vector
+    nyx_index_slot_t *device_slots;                 // device -> first vector of the device
+
+    uint32_t *device_next;                          // next vector of the same device, zero at the end of the chain
+
+} nyx_index_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint32_t interval_ms;                           // minimum delay between two publications, zero when unlimited
+
+    uint32_t last_ms;                               // time of the last publication, compared modulo 2^32 as millis() wraps
+
+    bool pending;                                   // a notification was held back during the current window
+
+} nyx_rate_limit_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 struct nyx_node_s
 {
     nyx_str_t node_id;
@@ -606,19 +917,39 @@ struct nyx_node_s
 
     bool enable_xml;
 
+    nyx_stream_policy_t stream_policy;
+
+    size_t stream_low_watermark;
+    size_t stream_high_watermark;
+
+    /**/
+
     nyx_stack_t *stack;
 
     nyx_dict_t **vectors;
 
+    nyx_index_t *index;
+
+    bool coalesce_notify;
+    bool pack_notify;
+
+    nyx_dict_t **pending_vectors;
+
+    __NYX_NULLABLE__ nyx_rate_limit_t *rate_limits;
+
     __NYX_ZEROABLE__ uint32_t client_hashes[31];
 
     /**/
 
+    #if !defined(ARDUINO)
     size_t (* tcp_handler)(
         struct nyx_node_s *node,
         nyx_event_type_t event_type,
+        const void *client,
+        nyx_xml_stream_t *xml_stream,
         nyx_str_t payload
     );
+    #endif
 
     void (* mqtt_handler)(
         struct nyx_node_s *node,
@@ -634,9 +965,12 @@ struct nyx_node_s
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/* Sends the message to every INDI client, or only to `client` (the handle given to tcp_handler) when not NULL. */
+
 void internal_indi_pub(
     const nyx_node_t *node,
-    nyx_str_t message
+    nyx_str_t message,
+    __NYX_NULLABLE__ const void *client
 );
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -665,6 +999,18 @@ void internal_stream_pub(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+bool internal_stream_pubv(
+    const nyx_node_t *node,
+    size_t n_messages,
+    const nyx_str_t messages[]
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t internal_get_millis(void);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 void nyx_node_ping(
     const nyx_node_t *node
 );
@@ -690,6 +1036,12 @@ bool internal_notify(
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+void internal_notify_flush(
+    const nyx_node_t *node
+);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 #ifndef ARDUINO
 #  pragma clang diagnostic pop
 #endif
@@ -7,18 +7,19 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
-#ifdef HAVE_MALLOC_SIZE
+#if !defined(ARDUINO)
 #  include <stdatomic.h>
+#endif
 
+#ifdef HAVE_MALLOC_SIZE
 size_t malloc_size(void *);
 #endif
 
 #ifdef HAVE_MALLOC_USABLE_SIZE
-#  include <stdatomic.h>
-
 size_t malloc_usable_size(void *);
 #endif
 
@@ -28,8 +29,267 @@ size_t malloc_usable_size(void *);
 /* MEMORY                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-#if defined(HAVE_MALLOC_SIZE) || defined(HAVE_MALLOC_USABLE_SIZE)
-static unsigned long used_mem = 0UL;
+#if NYX_MEMORY_POOL
+static size_t _pool_finalize(void);
+#endif
+
+static bool _arena_in_use(void);
+
+static buff_t _raw_alloc(size_t size);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* STATISTICS                                                                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+#if NYX_MEMORY_STATS
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define CATEGORY_IDX(category) \
+            ((size_t) (category) - (size_t) NYX_MEMORY_CATEGORY_OTHER)
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Each thread updates its own counters without atomics, they are only summed up by nyx_memory_stats(). */
+
+typedef struct counters_s
+{
+    struct counters_s *next;
+
+    long current[NYX_MEMORY_CATEGORY_NB + 1];
+    long peak[NYX_MEMORY_CATEGORY_NB + 1];
+    size_t count[NYX_MEMORY_CATEGORY_NB + 1];
+
+} counters_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(ARDUINO)
+static counters_t main_counters = {0};
+
+static counters_t *all_counters = &main_counters;
+
+static counters_t *curr_counters = &main_counters;
+#else
+static _Atomic(counters_t *) all_counters = NULL;
+
+static _Thread_local counters_t *curr_counters = NULL;
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static counters_t *_counters_get(void)
+{
+    #if !defined(ARDUINO)
+    if(curr_counters == NULL)
+    {
+        /* Counters outlive their thread, so that memory freed elsewhere is still balanced. */
+
+        curr_counters = memset(_raw_alloc(sizeof(counters_t)), 0x00, sizeof(counters_t));
+
+        curr_counters->next = atomic_load_explicit(&all_counters, memory_order_relaxed);
+
+        while(!atomic_compare_exchange_weak_explicit(&all_counters, &curr_counters->next, curr_counters, memory_order_release, memory_order_relaxed)) {}
+    }
+    #endif
+
+    return curr_counters;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ void _counters_add(counters_t *counters, size_t idx, long size)
+{
+    if((counters->current[idx] += size) > counters->peak[idx])
+    {
+        counters->peak[idx] = counters->current[idx];
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stats_alloc(nyx_memory_category_t category, size_t size)
+{
+    counters_t *counters = _counters_get();
+
+    _counters_add(counters, CATEGORY_IDX(category), (long) size);
+    _counters_add(counters, NYX_MEMORY_CATEGORY_NB, (long) size);
+
+    counters->count[CATEGORY_IDX(category)]++;
+    counters->count[NYX_MEMORY_CATEGORY_NB]++;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stats_free(nyx_memory_category_t category, size_t size)
+{
+    counters_t *counters = _counters_get();
+
+    counters->current[CATEGORY_IDX(category)] -= (long) size;
+    counters->current[NYX_MEMORY_CATEGORY_NB] -= (long) size;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static counters_t *_counters_first(void)
+{
+    #if defined(ARDUINO)
+    return all_counters;
+    #else
+    return atomic_load_explicit(&all_counters, memory_order_acquire);
+    #endif
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_memory_stats(nyx_memory_stats_t *stats)
+{
+    memset(stats, 0x00, sizeof(nyx_memory_stats_t));
+
+    #if NYX_MEMORY_STATS
+    for(counters_t *counters = _counters_first(); counters != NULL; counters = counters->next)
+    {
+        for(size_t i = 0; i <= NYX_MEMORY_CATEGORY_NB; i++)
+        {
+            nyx_memory_category_stats_t *category_stats = i < NYX_MEMORY_CATEGORY_NB ? &stats->categories[i] : &stats->total;
+
+            category_stats->current += (size_t) counters->current[i];
+            category_stats->peak += (size_t) counters->peak[i];
+            category_stats->count += counters->count[i];
+        }
+    }
+    #endif
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* ALLOCATOR                                                                                                          */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _default_alloc(__NYX_UNUSED__ void *ctx, size_t size)
+{
+    return malloc(size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _default_realloc(__NYX_UNUSED__ void *ctx, buff_t buff, size_t size)
+{
+    return realloc(buff, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _default_free(__NYX_UNUSED__ void *ctx, buff_t buff)
+{
+    free(buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(HAVE_MALLOC_SIZE)
+static size_t _default_usable_size(__NYX_UNUSED__ void *ctx, BUFF_t buff)
+{
+    return malloc_size((buff_t) buff);
+}
+#elif defined(HAVE_MALLOC_USABLE_SIZE)
+static size_t _default_usable_size(__NYX_UNUSED__ void *ctx, BUFF_t buff)
+{
+    return malloc_usable_size((buff_t) buff);
+}
+#else
+#  define _default_usable_size NULL
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define DEFAULT_ALLOCATOR {                     \
+            .alloc = _default_alloc,            \
+            .realloc = _default_realloc,        \
+            .free = _default_free,              \
+            .usable_size = _default_usable_size,\
+            .ctx = NULL,                        \
+        }
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_allocator_t allocator = DEFAULT_ALLOCATOR;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _raw_alloc(size_t size)
+{
+    buff_t result = allocator.alloc(allocator.ctx, size);
+
+    if(result == NULL)
+    {
+        NYX_LOG_FATAL("Out of memory");
+    }
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_memory_set_allocator(const nyx_allocator_t *new_allocator)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(new_allocator != NULL && (new_allocator->alloc == NULL || new_allocator->realloc == NULL || new_allocator->free == NULL))
+    {
+        NYX_LOG_ERROR("Invalid allocator");
+
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if NYX_MEMORY_POOL
+    bool pool_in_use = _pool_finalize() > 0;
+    #else
+    bool pool_in_use = false;
+    #endif
+
+    nyx_memory_stats_t stats;
+
+    nyx_memory_stats(&stats);
+
+    if(stats.total.current > 0 || pool_in_use || _arena_in_use())
+    {
+        NYX_LOG_ERROR("The allocator cannot be changed while memory is in use");
+
+        return false;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(new_allocator != NULL)
+    {
+        allocator = *new_allocator;
+    }
+    else
+    {
+        nyx_allocator_t default_allocator = DEFAULT_ALLOCATOR;
+
+        allocator = default_allocator;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if NYX_MEMORY_STATS
+static void _counters_reset(void)
+{
+    for(counters_t *counters = _counters_first(); counters != NULL; counters = counters->next)
+    {
+        memset(counters->current, 0x00, sizeof(counters->current));
+        memset(counters->peak, 0x00, sizeof(counters->peak));
+        memset(counters->count, 0x00, sizeof(counters->count));
+    }
+}
 #endif
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -38,11 +298,15 @@ void nyx_memory_initialize(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    #if defined(HAVE_MALLOC_SIZE) || defined(HAVE_MALLOC_USABLE_SIZE)
-    atomic_store_explicit(&used_mem, 0UL, memory_order_relaxed);
+    #if NYX_MEMORY_STATS
+    _counters_reset();
     #endif
 
     /*----------------------------------------------------------------------------------------------------------------*/
+
+    internal_base64_select(NYX_BASE64_IMPL_AUTO);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -51,8 +315,29 @@ bool nyx_memory_finalize(void)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    #if defined(HAVE_MALLOC_SIZE) || defined(HAVE_MALLOC_USABLE_SIZE)
-    unsigned long leaks = atomic_exchange_explicit(&used_mem, 0UL, memory_order_relaxed);
+    #if NYX_MEMORY_POOL
+    size_t pool_leaks = _pool_finalize();
+    #else
+    size_t pool_leaks = 0x00;
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if NYX_MEMORY_STATS
+    nyx_memory_stats_t stats;
+
+    nyx_memory_stats(&stats);
+
+    _counters_reset();
+
+    /* Pool chunks are already accounted as objects. */
+
+    unsigned long leaks = (unsigned long) stats.total.current; (void) pool_leaks;
+    #else
+    unsigned long leaks = (unsigned long) pool_leaks;
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
 
     if(leaks > 0UL)
     {
@@ -60,134 +345,774 @@ bool nyx_memory_finalize(void)
 
         return false;
     }
-    #endif
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     return true;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* HEAP                                                                                                               */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-size_t nyx_memory_free(buff_t buff)
+/* With a usable_size() callback, a block that already has room for the new size is grown without calling realloc(). */
+
+static bool _heap_fits(BUFF_t block, size_t size)
 {
-    if(buff == NULL)
+    return allocator.usable_size != NULL && allocator.usable_size(allocator.ctx, block) >= size;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#if NYX_MEMORY_STATS
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Blocks are prefixed with a header packing their requested size and category, so accounting never has to query */
+/* the allocator. The header is aligned like malloc() results, the returned memory is suitably aligned for any type. */
+
+typedef struct
+{
+    _Alignas(max_align_t) uint64_t info;
+
+} header_t;
+
+#define HEADER_SIZE_MASK 0x00FFFFFFFFFFFFFFULL
+
+#define HEADER_INFO(category, size) \
+            (((uint64_t) CATEGORY_IDX(category) << 56) | (uint64_t) (size))
+
+#define IDX_CATEGORY(idx) \
+            ((nyx_memory_category_t) ((size_t) NYX_MEMORY_CATEGORY_OTHER + (size_t) (idx)))
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _heap_tag(header_t *header, nyx_memory_category_t category, size_t size)
+{
+    header->info = HEADER_INFO(category, size);
+
+    _stats_alloc(category, size);
+
+    return header + 1;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static header_t *_heap_untag(buff_t buff, nyx_memory_category_t *category, size_t *size)
+{
+    header_t *header = (header_t *) buff - 1;
+
+    *size = (size_t) (header->info & HEADER_SIZE_MASK);
+
+    *category = IDX_CATEGORY(header->info >> 56);
+
+    _stats_free(*category, *size);
+
+    return header;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _heap_free(buff_t buff)
+{
+    nyx_memory_category_t category;
+
+    size_t result;
+
+    allocator.free(allocator.ctx, _heap_untag(buff, &category, &result));
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _heap_alloc(nyx_memory_category_t category, size_t size)
+{
+    return _heap_tag(_raw_alloc(sizeof(header_t) + size), category, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _heap_realloc(buff_t buff, size_t size)
+{
+    nyx_memory_category_t category;
+
+    size_t old_size;
+
+    header_t *header = _heap_untag(buff, &category, &old_size);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(size > old_size && _heap_fits(header, sizeof(header_t) + size))
+    {
+        return _heap_tag(header, category, size);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    header = allocator.realloc(allocator.ctx, header, sizeof(header_t) + size);
+
+    if(header == NULL)
+    {
+        NYX_LOG_FATAL("Out of memory");
+    }
+
+    return _heap_tag(header, category, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#else
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _heap_free(buff_t buff)
+{
+    allocator.free(allocator.ctx, buff);
+
+    return 0x00;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _heap_alloc(__NYX_UNUSED__ nyx_memory_category_t category, size_t size)
+{
+    return _raw_alloc(size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _heap_realloc(buff_t buff, size_t size)
+{
+    if(_heap_fits(buff, size))
+    {
+        return buff;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    buff_t result = allocator.realloc(allocator.ctx, buff, size);
+
+    if(result == NULL)
+    {
+        NYX_LOG_FATAL("Out of memory");
+    }
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* ARENA                                                                                                              */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define ARENA_ALIGN(size) \
+            (((size) + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1))
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct nyx_arena_block_s
+{
+    struct nyx_arena_block_s *next;
+
+    size_t size;
+    size_t used;
+    size_t last;
+
+    max_align_t data[];
+
+} nyx_arena_block_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+struct nyx_arena_s
+{
+    nyx_arena_block_t *blocks;
+
+    nyx_object_t *root;
+
+    struct nyx_arena_s *prev;
+    struct nyx_arena_s *next;
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Arena allocated memory is only ever released by the thread that parsed it. */
+
+#if defined(ARDUINO)
+static nyx_arena_t *curr_arena = NULL;
+static nyx_arena_t *live_arenas = NULL;
+#else
+static _Thread_local nyx_arena_t *curr_arena = NULL;
+static _Thread_local nyx_arena_t *live_arenas = NULL;
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _arena_in_use(void)
+{
+    return live_arenas != NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Only called for memory that may belong to an arena: while an arena is current, or for the storage of arena objects. */
+
+static nyx_arena_block_t *_arena_find(nyx_arena_t **arena, BUFF_t buff)
+{
+    for(nyx_arena_t *curr = live_arenas; curr != NULL; curr = curr->next)
+    {
+        for(nyx_arena_block_t *block = curr->blocks; block != NULL; block = block->next)
+        {
+            if((STR_t) buff >= (STR_t) block->data
+               &&
+               (STR_t) buff < (STR_t) block->data + block->size
+            ) {
+                *arena = curr;
+
+                return block;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _arena_alloc(nyx_arena_t *arena, size_t size)
+{
+    size = ARENA_ALIGN(size);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_arena_block_t *block = arena->blocks;
+
+    if(block == NULL || block->size - block->used < size)
+    {
+        size_t block_size = size > NYX_ARENA_BLOCK_SIZE ? size : NYX_ARENA_BLOCK_SIZE;
+
+        block = _heap_alloc(NYX_MEMORY_CATEGORY_OBJECT, sizeof(nyx_arena_block_t) + block_size);
+
+        block->next = arena->blocks;
+        block->size = block_size;
+        block->used = 0x00;
+        block->last = 0x00;
+
+        arena->blocks = block;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    buff_t result = (str_t) block->data + block->used;
+
+    block->last = block->used;
+    block->used += size;
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _arena_realloc(nyx_arena_t *arena, nyx_arena_block_t *block, buff_t buff, size_t size)
+{
+    size_t offset = (size_t) ((str_t) buff - (str_t) block->data);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* The last allocation of a block can be resized in place. */
+
+    if(offset == block->last && block->size - offset >= ARENA_ALIGN(size))
+    {
+        block->used = offset + ARENA_ALIGN(size);
+
+        return buff;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Otherwise, the old size is unknown but never exceeds what has been used after it. */
+
+    size_t avail = block->used - offset;
+
+    buff_t result = _arena_alloc(arena, size);
+
+    memcpy(result, buff, avail < size ? avail : size);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _arena_release(nyx_arena_t *arena)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(nyx_arena_t **curr = &live_arenas; *curr != NULL; curr = &(*curr)->next)
+    {
+        if(*curr == arena)
+        {
+            *curr = arena->next;
+
+            break;
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(nyx_arena_block_t *block = arena->blocks, *next; block != NULL; block = next)
+    {
+        next = block->next;
+
+        _heap_free(block);
+    }
+
+    _heap_free(arena);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_arena_t *internal_arena_begin(void)
+{
+    nyx_arena_t *arena = _heap_alloc(NYX_MEMORY_CATEGORY_OBJECT, sizeof(nyx_arena_t));
+
+    arena->blocks = NULL;
+    arena->root = NULL;
+
+    arena->prev = curr_arena;
+    arena->next = live_arenas;
+
+    curr_arena = live_arenas = arena;
+
+    return arena;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void internal_arena_end(nyx_arena_t *arena, nyx_object_t *root)
+{
+    curr_arena = arena->prev;
+
+    if(root != NULL)
+    {
+        arena->root = root;
+    }
+    else
+    {
+        _arena_release(arena);
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_arena_active(void)
+{
+    return curr_arena != NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_arena_frozen(const nyx_object_t *object)
+{
+    if(object->in_arena && curr_arena == NULL)
+    {
+        NYX_LOG_ERROR("Arena objects are read-only");
+
+        return true;
+    }
+
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _memory_free(buff_t buff, bool maybe_arena)
+{
+    if(buff == NULL)
+    {
+        return 0x00;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_arena_t *arena;
+
+    if(maybe_arena && _arena_find(&arena, buff) != NULL)
+    {
+        return 0x00;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return _heap_free(buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+size_t nyx_memory_free(buff_t buff)
+{
+    return _memory_free(buff, curr_arena != NULL);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void internal_object_memory_free(const nyx_object_t *owner, buff_t buff)
+{
+    _memory_free(buff, owner->in_arena || curr_arena != NULL);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_memory_category_alloc(nyx_memory_category_t category, size_t size)
+{
+    if(size == 0x00)
+    {
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(curr_arena != NULL)
+    {
+        return _arena_alloc(curr_arena, size);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return _heap_alloc(category, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t _memory_realloc(nyx_memory_category_t category, buff_t buff, size_t size, bool maybe_arena)
+{
+    if(buff == NULL) {
+        return nyx_memory_category_alloc(category, size);
+    }
+
+    if(size == 0x00) {
+        _memory_free(buff, maybe_arena); return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_arena_t *arena;
+
+    nyx_arena_block_t *block;
+
+    if(maybe_arena && (block = _arena_find(&arena, buff)) != NULL)
+    {
+        return _arena_realloc(arena, block, buff, size);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return _heap_realloc(buff, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_memory_category_realloc(nyx_memory_category_t category, buff_t buff, size_t size)
+{
+    return _memory_realloc(category, buff, size, curr_arena != NULL);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t internal_object_memory_realloc(const nyx_object_t *owner, nyx_memory_category_t category, buff_t buff, size_t size)
+{
+    return _memory_realloc(category, buff, size, owner->in_arena || curr_arena != NULL);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_memory_alloc(size_t size)
+{
+    return nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_OTHER, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_memory_realloc(buff_t buff, size_t size)
+{
+    return nyx_memory_category_realloc(NYX_MEMORY_CATEGORY_OTHER, buff, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* POOL                                                                                                               */
+/*--------------------------------------------------------------------------------------------------------------------*/
+#if NYX_MEMORY_POOL
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define POOL_CLASS_SIZE _Alignof(max_align_t)
+
+#define POOL_CLASS_NB ((NYX_MEMORY_POOL_MAX_SIZE + POOL_CLASS_SIZE - 1) / POOL_CLASS_SIZE)
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct pool_chunk_s
+{
+    struct pool_chunk_s *next;
+
+} pool_chunk_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct pool_slab_s
+{
+    struct pool_slab_s *next;
+
+    max_align_t data[];
+
+} pool_slab_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static pool_chunk_t *pool_chunks[POOL_CLASS_NB] = {NULL};
+
+static pool_slab_t *pool_slabs = NULL;
+
+static nyx_memory_pool_stats_t pool_stats = {0};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if NYX_MEMORY_POOL_STATIC_SIZE > 0
+static max_align_t pool_region[(NYX_MEMORY_POOL_STATIC_SIZE + sizeof(max_align_t) - 1) / sizeof(max_align_t)];
+
+static size_t pool_region_used = 0;
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(ARDUINO)
+#  define POOL_LOCK()
+#  define POOL_UNLOCK()
+#else
+static atomic_flag pool_lock = ATOMIC_FLAG_INIT;
+
+#  define POOL_LOCK() \
+            while(atomic_flag_test_and_set_explicit(&pool_lock, memory_order_acquire)) {}
+
+#  define POOL_UNLOCK() \
+            atomic_flag_clear_explicit(&pool_lock, memory_order_release)
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _pool_grow(size_t class_idx)
+{
+    size_t chunk_size = (class_idx + 1) * POOL_CLASS_SIZE;
+
+    str_t data;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if NYX_MEMORY_POOL_STATIC_SIZE > 0
+    if(sizeof(pool_region) - pool_region_used >= NYX_MEMORY_POOL_SLAB_SIZE)
+    {
+        data = (str_t) pool_region + pool_region_used;
+
+        pool_region_used += NYX_MEMORY_POOL_SLAB_SIZE;
+    }
+    else
+    #endif
+    {
+        /* Slabs are not accounted as used memory, only the chunks handed out are. */
+
+        pool_slab_t *slab = allocator.alloc(allocator.ctx, sizeof(pool_slab_t) + NYX_MEMORY_POOL_SLAB_SIZE);
+
+        if(slab == NULL)
+        {
+            NYX_LOG_FATAL("Out of memory");
+        }
+
+        slab->next = pool_slabs;
+
+        pool_slabs = slab;
+
+        data = (str_t) slab->data;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(size_t offset = 0; offset + chunk_size <= NYX_MEMORY_POOL_SLAB_SIZE; offset += chunk_size)
+    {
+        pool_chunk_t *chunk = (pool_chunk_t *) (data + offset);
+
+        chunk->next = pool_chunks[class_idx];
+
+        pool_chunks[class_idx] = chunk;
+
+        pool_stats.free_chunks++;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    pool_stats.slab_count++;
+    pool_stats.slab_bytes += NYX_MEMORY_POOL_SLAB_SIZE;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _pool_finalize(void)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Slabs can only be given back once every chunk has been returned, otherwise these chunks are leaks. */
+
+    if(pool_stats.used_chunks > 0)
+    {
+        return pool_stats.used_bytes;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(pool_slab_t *slab = pool_slabs, *next; slab != NULL; slab = next)
+    {
+        next = slab->next;
+
+        allocator.free(allocator.ctx, slab);
+    }
+
+    pool_slabs = NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    memset(pool_chunks, 0x00, sizeof(pool_chunks));
+
+    memset(&pool_stats, 0x00, sizeof(pool_stats));
+
+    #if NYX_MEMORY_POOL_STATIC_SIZE > 0
+    pool_region_used = 0;
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return 0x00;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_memory_pool_alloc(size_t size)
+{
+    #if NYX_MEMORY_POOL
+    if(size > 0x00 && size <= NYX_MEMORY_POOL_MAX_SIZE && curr_arena == NULL)
     {
-        return 0x00;
-    }
+        size_t class_idx = (size - 1) / POOL_CLASS_SIZE;
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-    #ifdef HAVE_MALLOC_SIZE
-    size_t result = malloc_size(buff);
+        POOL_LOCK();
 
-    atomic_fetch_sub_explicit(&used_mem, result, memory_order_relaxed);
-    #endif
+        if(pool_chunks[class_idx] == NULL)
+        {
+            _pool_grow(class_idx);
+        }
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        pool_chunk_t *chunk = pool_chunks[class_idx];
 
-    #ifdef HAVE_MALLOC_USABLE_SIZE
-    size_t result = malloc_usable_size(buff);
+        pool_chunks[class_idx] = chunk->next;
 
-    atomic_fetch_sub_explicit(&used_mem, result, memory_order_relaxed);
-    #endif
+        pool_stats.free_chunks--;
+        pool_stats.used_chunks++;
+        pool_stats.used_bytes += (class_idx + 1) * POOL_CLASS_SIZE;
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        POOL_UNLOCK();
 
-    free(buff);
+        #if NYX_MEMORY_STATS
+        _stats_alloc(NYX_MEMORY_CATEGORY_OBJECT, (class_idx + 1) * POOL_CLASS_SIZE);
+        #endif
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-    #if defined(HAVE_MALLOC_SIZE) || defined(HAVE_MALLOC_USABLE_SIZE)
-    return result;
-    #else
-    return 0x0000;
+        return chunk;
+    }
     #endif
+
+    return nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_OBJECT, size);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-buff_t nyx_memory_alloc(size_t size)
+static void _memory_pool_free(buff_t buff, size_t size, bool maybe_arena)
 {
-    if(size == 0x00)
+    #if NYX_MEMORY_POOL
+    if(buff != NULL && size <= NYX_MEMORY_POOL_MAX_SIZE)
     {
-        return NULL;
-    }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
+        nyx_arena_t *arena;
 
-    buff_t result = malloc(size);
+        if(maybe_arena && _arena_find(&arena, buff) != NULL)
+        {
+            return;
+        }
 
-    if(result == NULL)
-    {
-        NYX_LOG_FATAL("Out of memory");
-    }
+        /*------------------------------------------------------------------------------------------------------------*/
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        size_t class_idx = (size - 1) / POOL_CLASS_SIZE;
 
-    #ifdef HAVE_MALLOC_SIZE
-    atomic_fetch_add_explicit(&used_mem, malloc_size(result), memory_order_relaxed);
-    #endif
+        pool_chunk_t *chunk = (pool_chunk_t *) buff;
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-    #ifdef HAVE_MALLOC_USABLE_SIZE
-    atomic_fetch_add_explicit(&used_mem, malloc_usable_size(result), memory_order_relaxed);
-    #endif
+        POOL_LOCK();
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        chunk->next = pool_chunks[class_idx];
 
-    return result;
-}
+        pool_chunks[class_idx] = chunk;
 
-/*--------------------------------------------------------------------------------------------------------------------*/
+        pool_stats.free_chunks++;
+        pool_stats.used_chunks--;
+        pool_stats.used_bytes -= (class_idx + 1) * POOL_CLASS_SIZE;
 
-buff_t nyx_memory_realloc(buff_t buff, size_t size)
-{
-    if(buff == NULL) {
-        return nyx_memory_alloc(size);
-    }
+        POOL_UNLOCK();
 
-    if(size == 0x00) {
-        nyx_memory_free(buff); return NULL;
-    }
+        #if NYX_MEMORY_STATS
+        _stats_free(NYX_MEMORY_CATEGORY_OBJECT, (class_idx + 1) * POOL_CLASS_SIZE);
+        #endif
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+        /*------------------------------------------------------------------------------------------------------------*/
 
-    #ifdef HAVE_MALLOC_SIZE
-    atomic_fetch_sub_explicit(&used_mem, malloc_size(buff), memory_order_relaxed);
+        return;
+    }
+    #else
+    (void) size;
     #endif
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+    _memory_free(buff, maybe_arena);
+}
 
-    #ifdef HAVE_MALLOC_USABLE_SIZE
-    atomic_fetch_sub_explicit(&used_mem, malloc_usable_size(buff), memory_order_relaxed);
-    #endif
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+void nyx_memory_pool_free(buff_t buff, size_t size)
+{
+    _memory_pool_free(buff, size, curr_arena != NULL);
+}
 
-    buff_t result = realloc(buff, size);
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-    if(result == NULL)
-    {
-        NYX_LOG_FATAL("Out of memory");
-    }
+void internal_object_memory_pool_free(const nyx_object_t *owner, buff_t buff, size_t size)
+{
+    _memory_pool_free(buff, size, owner->in_arena || curr_arena != NULL);
+}
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-    #ifdef HAVE_MALLOC_SIZE
-    atomic_fetch_add_explicit(&used_mem, malloc_size(result), memory_order_relaxed);
-    #endif
+void nyx_memory_pool_stats(nyx_memory_pool_stats_t *stats)
+{
+    #if NYX_MEMORY_POOL
+    POOL_LOCK();
 
-    /*----------------------------------------------------------------------------------------------------------------*/
+    *stats = pool_stats;
 
-    #ifdef HAVE_MALLOC_USABLE_SIZE
-    atomic_fetch_add_explicit(&used_mem, malloc_usable_size(result), memory_order_relaxed);
+    POOL_UNLOCK();
+    #else
+    memset(stats, 0x00, sizeof(nyx_memory_pool_stats_t));
     #endif
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    return result;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -199,10 +1124,10 @@ str_t nyx_bool_dup(bool b)
     str_t str;
 
     if(b) {
-        str = strcpy(nyx_memory_alloc(4 + 1), "true");
+        str = strcpy(nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, 4 + 1), "true");
     }
     else {
-        str = strcpy(nyx_memory_alloc(5 + 1), "false");
+        str = strcpy(nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, 5 + 1), "false");
     }
 
     return str;
@@ -214,7 +1139,7 @@ str_t nyx_double_dup(double d)
 {
     if(!isnan(d))
     {
-        str_t str = nyx_memory_alloc(32 + 1);
+        str_t str = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, 32 + 1);
 
         snprintf(str, 32 + 1, "%f", d);
 
@@ -232,7 +1157,7 @@ str_t nyx_string_dup(STR_t s)
     {
         size_t len = strlen(s);
 
-        str_t str = nyx_memory_alloc(len + 1);
+        str_t str = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, len + 1);
 
         memcpy(str, s, len);
 
@@ -252,7 +1177,7 @@ str_t nyx_string_ndup(STR_t s, size_t n)
     {
         size_t len = strnlen(s, n);
 
-        str_t str = nyx_memory_alloc(len + 1);
+        str_t str = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, len + 1);
 
         memcpy(str, s, len);
 
@@ -270,7 +1195,7 @@ buff_t nyx_buffer_ndup(BUFF_t b, size_t n)
 {
     if(b != NULL)
     {
-        buff_t buff = nyx_memory_alloc(n);
+        buff_t buff = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, n);
 
         memcpy(buff, b, n);
 
@@ -290,6 +1215,149 @@ nyx_str_t nyx_str_s(STR_t s)
     return str;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* SERIALIZER                                                                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _append_object(nyx_string_builder_t *sb, const nyx_object_t *object) // NOLINT(misc-no-recursion)
+{
+    switch(object->type)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_NULL:
+            nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 4, "null");
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_NUMBER:
+            {
+                double value = ((const nyx_number_t *) object)->value;
+
+                if(!isnan(value))
+                {
+                    char str[32 + 1];
+
+                    int len = snprintf(str, sizeof(str), "%f", value);
+
+                    nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, len < (int) sizeof(str) ? (size_t) len : sizeof(str) - 1, str);
+                }
+                else
+                {
+                    nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 4, "null");
+                }
+            }
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_BOOLEAN:
+            if(((const nyx_boolean_t *) object)->value) {
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 4, "true");
+            }
+            else {
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 5, "false");
+            }
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_STRING:
+            {
+                STR_t value = ((const nyx_string_t *) object)->value;
+
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "\"");
+                nyx_string_builder_append_buff(sb, NYX_SB_ESCAPE_JSON, strlen(value), value);
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "\"");
+            }
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_LIST:
+            {
+                const nyx_list_t *list = (const nyx_list_t *) object;
+
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "[");
+
+                for(size_t i = 0; i < list->size; i++)
+                {
+                    if(i > 0)
+                    {
+                        nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, ",");
+                    }
+
+                    _append_object(sb, list->items[i]);
+                }
+
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "]");
+            }
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        case NYX_TYPE_DICT:
+            {
+                const nyx_dict_t *dict = (const nyx_dict_t *) object;
+
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "{");
+
+                for(const nyx_dict_node_t *node = dict->head; node != NULL; node = node->next)
+                {
+                    if(node != dict->head)
+                    {
+                        nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, ",");
+                    }
+
+                    nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "\"");
+                    nyx_string_builder_append_buff(sb, NYX_SB_ESCAPE_JSON, strlen(node->key), node->key);
+                    nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 2, "\":");
+
+                    _append_object(sb, node->value);
+                }
+
+                nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, 1, "}");
+            }
+            break;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        default:
+            NYX_LOG_FATAL("Invalid object type");
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+str_t internal_object_to_string(const nyx_object_t *object, bool cstring)
+{
+    nyx_string_builder_t *sb = nyx_string_builder_new();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(cstring && object->type == NYX_TYPE_STRING)
+    {
+        STR_t value = ((const nyx_string_t *) object)->value;
+
+        nyx_string_builder_append_buff(sb, NYX_SB_NO_ESCAPE, strlen(value), value);
+    }
+    else
+    {
+        _append_object(sb, object);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t result = nyx_string_builder_to_string(sb);
+
+    nyx_string_builder_free(sb);
+
+    return result;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* OBJECT                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -383,6 +1451,27 @@ nyx_object_t *nyx_object_unref(void *object)
     {
         ((nyx_object_t *) object)->ref = 0;
 
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(((nyx_object_t *) object)->in_arena)
+        {
+            /* Arena objects are released all at once with their root. */
+
+            for(nyx_arena_t *arena = live_arenas; arena != NULL; arena = arena->next)
+            {
+                if(arena->root == object)
+                {
+                    _arena_release(arena);
+
+                    break;
+                }
+            }
+
+            return NULL;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
         _object_free(object); object = NULL;
     }
     else
@@ -404,6 +1493,26 @@ nyx_type_t nyx_object_get_type(const nyx_object_t *object)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+bool internal_mark_dirty(nyx_object_t *object, bool modified)
+{
+    if(modified && object != NULL)
+    {
+        object->flags |= NYX_FLAGS_DIRTY;
+
+        for(; object != NULL; object = object->parent)
+        {
+            if(object->type == NYX_TYPE_DICT)
+            {
+                internal_dict_uncache((nyx_dict_t *) object);
+            }
+        }
+    }
+
+    return modified;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 bool nyx_object_notify(const nyx_object_t *object)
 {
     for(; object != NULL; object = object->parent)
@@ -419,7 +1528,71 @@ bool nyx_object_notify(const nyx_object_t *object)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool nyx_object_equal(const nyx_object_t *object1, const nyx_object_t *object2)
+/* NaN is a legitimate INDI value (e.g. unknown reading): two NaNs are equal, otherwise they would never compare as */
+/* unchanged.                                                                                                      */
+
+__NYX_INLINE__ bool _number_equal(const nyx_number_t *number1, const nyx_number_t *number2)
+{
+    return number1->value == number2->value || (isnan(number1->value) && isnan(number2->value));
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ bool _string_equal(const nyx_string_t *string1, const nyx_string_t *string2)
+{
+    return string1->length == string2->length && memcmp(string1->value, string2->value, string1->length) == 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _list_equal(const nyx_list_t *list1, const nyx_list_t *list2) // NOLINT(misc-no-recursion)
+{
+    if(list1->size != list2->size)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < list1->size; i++)
+    {
+        if(!nyx_object_equal(list1->items[i], list2->items[i]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _dict_equal(const nyx_dict_t *dict1, const nyx_dict_t *dict2) // NOLINT(misc-no-recursion)
+{
+    if(dict1->size != dict2->size)
+    {
+        return false;
+    }
+
+    /* Entries are compared in order, like their serialized form used to be. */
+
+    for(const nyx_dict_node_t *node1 = dict1->head, *node2 = dict2->head; node1 != NULL && node2 != NULL; node1 = node1->next, node2 = node2->next)
+    {
+        if(node1->key != node2->key && (node1->hash != node2->hash || strcmp(node1->key, node2->key) != 0))
+        {
+            return false;
+        }
+
+        if(!nyx_object_equal(node1->value, node2->value))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_object_equal(const nyx_object_t *object1, const nyx_object_t *object2) // NOLINT(misc-no-recursion)
 {
     if(object1 == NULL || object2 == NULL)
     {
@@ -451,27 +1624,19 @@ bool nyx_object_equal(const nyx_object_t *object1, const nyx_object_t *object2)
             return true;
 
         case NYX_TYPE_NUMBER:
-            return ((const nyx_number_t *) object1)->value == ((const nyx_number_t *) object2)->value;
+            return _number_equal((const nyx_number_t *) object1, (const nyx_number_t *) object2);
 
         case NYX_TYPE_BOOLEAN:
             return ((const nyx_boolean_t *) object1)->value == ((const nyx_boolean_t *) object2)->value;
 
         case NYX_TYPE_STRING:
-            return strcmp(((const nyx_string_t *) object1)->value, ((const nyx_string_t *) object2)->value) == 0;
+            return _string_equal((const nyx_string_t *) object1, (const nyx_string_t *) object2);
 
         case NYX_TYPE_LIST:
-        case NYX_TYPE_DICT:
-            {
-                str_t s1 = nyx_object_to_string(object1);
-                str_t s2 = nyx_object_to_string(object2);
-
-                bool equal = strcmp(s1, s2) == 0;
-
-                nyx_memory_free(s1);
-                nyx_memory_free(s2);
+            return _list_equal((const nyx_list_t *) object1, (const nyx_list_t *) object2);
 
-                return equal;
-            }
+        case NYX_TYPE_DICT:
+            return _dict_equal((const nyx_dict_t *) object1, (const nyx_dict_t *) object2);
 
         default:
             NYX_LOG_FATAL("Invalid object type");
@@ -496,29 +1661,7 @@ str_t nyx_object_to_string(const nyx_object_t *object)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    switch(object->type)
-    {
-        case NYX_TYPE_NULL:
-            return nyx_null_to_string((const nyx_null_t *) object);
-
-        case NYX_TYPE_NUMBER:
-            return nyx_number_to_string((const nyx_number_t *) object);
-
-        case NYX_TYPE_BOOLEAN:
-            return nyx_boolean_to_string((const nyx_boolean_t *) object);
-
-        case NYX_TYPE_STRING:
-            return nyx_string_to_string((const nyx_string_t *) object);
-
-        case NYX_TYPE_LIST:
-            return nyx_list_to_string((const nyx_list_t *) object);
-
-        case NYX_TYPE_DICT:
-            return nyx_dict_to_string((const nyx_dict_t *) object);
-
-        default:
-            NYX_LOG_FATAL("Invalid object type");
-    }
+    return internal_object_to_string(object, false);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 }
@@ -539,29 +1682,7 @@ str_t nyx_object_to_cstring(const nyx_object_t *object)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    switch(object->type)
-    {
-        case NYX_TYPE_NULL:
-            return nyx_null_to_string((const nyx_null_t *) object);
-
-        case NYX_TYPE_NUMBER:
-            return nyx_number_to_string((const nyx_number_t *) object);
-
-        case NYX_TYPE_BOOLEAN:
-            return nyx_boolean_to_string((const nyx_boolean_t *) object);
-
-        case NYX_TYPE_STRING:
-            return nyx_string_to_cstring((const nyx_string_t *) object);
-
-        case NYX_TYPE_LIST:
-            return nyx_list_to_string((const nyx_list_t *) object);
-
-        case NYX_TYPE_DICT:
-            return nyx_dict_to_string((const nyx_dict_t *) object);
-
-        default:
-            NYX_LOG_FATAL("Invalid object type");
-    }
+    return internal_object_to_string(object, true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 }
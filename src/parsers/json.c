@@ -15,6 +15,10 @@
 /* DEFINITIONS                                                                                                        */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#define NYX_JSON_NUMBER_MAX_LENGTH 64
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 typedef enum
 {
     JSON_TOKEN_EOF,
@@ -38,6 +42,7 @@ typedef enum
 typedef struct
 {
     str_t value;
+    size_t length;
 
     json_token_type_t token_type;
 
@@ -50,6 +55,8 @@ typedef struct
     size_t size;
     STR_t buff;
 
+    bool in_situ;
+
     json_token_t curr_token;
 
 } json_parser_t;
@@ -73,10 +80,18 @@ typedef struct
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#define FREE(v) \
+            if(parser->in_situ == false)                                                    \
+            {                                                                               \
+                nyx_memory_free(v);                                                         \
+            }                                                                               \
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 #define RELEASE(t) \
-            if(CHECK(JSON_TOKEN_NUMBER) || CHECK(JSON_TOKEN_STRING))                        \
+            if(CHECK(JSON_TOKEN_STRING))                                                    \
             {                                                                               \
-                nyx_memory_free(PEEK().value);                                              \
+                FREE(PEEK().value);                                                         \
                                                                                             \
                 PEEK().value = NULL;                                                        \
             }                                                                               \
@@ -104,8 +119,24 @@ typedef struct
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-static bool jsoncpy(str_t p, STR_t s, STR_t e)
+static str_t jsoncpy(str_t p, STR_t s, STR_t e, bool escaped)
 {
+    if(escaped == false)
+    {
+        size_t length = (size_t) (e - s);
+
+        if(p != s)
+        {
+            memcpy(p, s, length);
+        }
+
+        p[length] = '\0';
+
+        return p + length;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
     while(s < e)
     {
         if(*s == '\\')
@@ -142,7 +173,7 @@ static bool jsoncpy(str_t p, STR_t s, STR_t e)
                         }
                         else
                         {
-                            return false;
+                            return NULL;
                         }
                         break;
                     default:
@@ -152,7 +183,7 @@ static bool jsoncpy(str_t p, STR_t s, STR_t e)
             }
             else
             {
-                return false;
+                return NULL;
             }
         }
         else
@@ -164,7 +195,7 @@ static bool jsoncpy(str_t p, STR_t s, STR_t e)
 
     *p = '\0';
 
-    return true;
+    return p;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -174,6 +205,7 @@ static void tokenizer_next(json_parser_t *parser)
     /*----------------------------------------------------------------------------------------------------------------*/
 
     PEEK().value = NULL;
+    PEEK().length = 0;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -199,6 +231,8 @@ static void tokenizer_next(json_parser_t *parser)
 
     json_token_type_t type;
 
+    bool escaped = false;
+
     switch(*parser->buff)
     {
         /*------------------------------------------------------------------------------------------------------------*/
@@ -273,6 +307,7 @@ static void tokenizer_next(json_parser_t *parser)
                    &&
                    *(end + 1) != '\0'
                 )) {
+                    escaped = true;
                     end++;
                     parser->size--;
                 }
@@ -340,7 +375,8 @@ static void tokenizer_next(json_parser_t *parser)
 
         size_t length = TRIM(s, e);
 
-        parser->curr_token.value = nyx_string_ndup(s, length);
+        parser->curr_token.value = (str_t) /* NOSONAR */ s;
+        parser->curr_token.length = length;
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -352,15 +388,22 @@ static void tokenizer_next(json_parser_t *parser)
 
         size_t length = TRIM(s, e);
 
-        str_t p = parser->curr_token.value = nyx_memory_alloc(length + 1);
+        /* In situ, strings are unescaped in place: the decoded form is never longer than its source and, for empty */
+        /* strings, the terminator goes over the opening quote since TRIM may have moved `s` past the token.        */
+
+        str_t p = parser->in_situ ? (str_t) /* NOSONAR */ (length > 0 ? s : start) : nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, length + 1);
+
+        str_t q = jsoncpy(p, s, e, escaped);
 
-        if(jsoncpy(p, s, e) == false)
+        if(q == NULL)
         {
-            nyx_memory_free(parser->curr_token.value);
-            parser->curr_token.value = NULL;
+            FREE(p);
             type = JSON_TOKEN_ERROR;
             goto _bye;
         }
+
+        parser->curr_token.value = p;
+        parser->curr_token.length = (size_t) (q - p);
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -430,11 +473,31 @@ static nyx_number_t *json_parse_number(json_parser_t *parser)
         return NULL;
     }
 
-    str_t value = PEEK().value;
+    STR_t value = PEEK().value;
+    size_t length = PEEK().length;
 
-    nyx_number_t *result = nyx_number_from(atof(value)); // NOLINT(*-err34-c)
+    double number;
 
-    nyx_memory_free(value);
+    if(length < NYX_JSON_NUMBER_MAX_LENGTH)
+    {
+        char temp[NYX_JSON_NUMBER_MAX_LENGTH];
+
+        memcpy(temp, value, length);
+
+        temp[length] = '\0';
+
+        number = atof(temp); // NOLINT(*-err34-c)
+    }
+    else
+    {
+        str_t temp = nyx_string_ndup(value, length);
+
+        number = atof(temp); // NOLINT(*-err34-c)
+
+        nyx_memory_free(temp);
+    }
+
+    nyx_number_t *result = nyx_number_from(number);
 
     NEXT();
 
@@ -452,7 +515,7 @@ static nyx_string_t *json_parse_string(json_parser_t *parser)
 
     str_t value = PEEK().value;
 
-    nyx_string_t *result = nyx_string_from(/**/(value), true); // NOLINT(*-err34-c)
+    nyx_string_t *result = nyx_string_from(value, parser->in_situ == false); // NOLINT(*-err34-c)
 
     // don't free the value
 
@@ -495,7 +558,7 @@ static nyx_dict_t *json_parse_dict(json_parser_t *parser) // NOLINT(misc-no-recu
 
         if(CHECK(JSON_TOKEN_COLON) == false)
         {
-            nyx_memory_free(key);
+            FREE(key);
 
             goto _err;
         }
@@ -530,7 +593,7 @@ static nyx_dict_t *json_parse_dict(json_parser_t *parser) // NOLINT(misc-no-recu
 
         if(value == NULL)
         {
-            nyx_memory_free(key);
+            FREE(key);
 
             goto _err;
         }
@@ -543,7 +606,7 @@ static nyx_dict_t *json_parse_dict(json_parser_t *parser) // NOLINT(misc-no-recu
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        nyx_memory_free(key);
+        FREE(key);
 
         /*------------------------------------------------------------------------------------------------------------*/
 
@@ -689,7 +752,7 @@ _err:
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-nyx_object_t *nyx_object_parse_buff(size_t size, BUFF_t buff)
+static nyx_object_t *json_parse(size_t size, BUFF_t buff, bool in_situ)
 {
     if(size == 0x00
        ||
@@ -703,8 +766,10 @@ nyx_object_t *nyx_object_parse_buff(size_t size, BUFF_t buff)
     json_parser_t *parser = &(json_parser_t) {
         .size = size,
         .buff = buff,
+        .in_situ = in_situ,
         .curr_token = {
             .value = NULL,
+            .length = 0,
             .token_type = JSON_TOKEN_ERROR,
         },
     };
@@ -743,12 +808,7 @@ nyx_object_t *nyx_object_parse_buff(size_t size, BUFF_t buff)
 
     if(result == NULL || CHECK(JSON_TOKEN_EOF) == false)
     {
-        if(parser->curr_token.value != NULL)
-        {
-            nyx_memory_free(parser->curr_token.value);
-
-            parser->curr_token.value = NULL;
-        }
+        RELEASE(JSON_TOKEN_ERROR);
 
         nyx_object_unref(result);
 
@@ -762,6 +822,20 @@ nyx_object_t *nyx_object_parse_buff(size_t size, BUFF_t buff)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+nyx_object_t *nyx_object_parse_buff(size_t size, BUFF_t buff)
+{
+    return json_parse(size, buff, false);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_object_t *internal_object_parse_buff_in_situ(size_t size, buff_t buff)
+{
+    return json_parse(size, buff, true);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 nyx_object_t *nyx_object_parse(STR_t string)
 {
     if(string == NULL)
@@ -39,6 +39,9 @@ typedef struct
 {
     str_t value;
 
+    STR_t s;
+    STR_t e;
+
     xml_token_type_t token_type;
 
 } xml_token_t;
@@ -48,6 +51,7 @@ typedef struct
 typedef struct
 {
     bool tag;
+    bool lazy;
 
     size_t size;
     STR_t buff;
@@ -88,45 +92,59 @@ static const int XML_IDENT_TAB[256] = {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/* Decodes the entity starting at `s`, returns the number of bytes consumed or zero if the entity is invalid. */
+
+static size_t xml_entity(char *c, STR_t s, STR_t e)
+{
+    size_t size = (size_t) e - (size_t) s;
+
+    /**/ if(size >= 4 && strncmp(s, "&lt;", 4) == 0)
+    {
+        *c = '<';
+        return 4;
+    }
+    else if(size >= 4 && strncmp(s, "&gt;", 4) == 0)
+    {
+        *c = '>';
+        return 4;
+    }
+    else if(size >= 5 && strncmp(s, "&amp;", 5) == 0)
+    {
+        *c = '&';
+        return 5;
+    }
+    else if(size >= 6 && strncmp(s, "&quot;", 6) == 0)
+    {
+        *c = '\"';
+        return 6;
+    }
+    else if(size >= 6 && strncmp(s, "&apos;", 6) == 0)
+    {
+        *c = '\'';
+        return 6;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 static bool xmlcpy(str_t p, STR_t s, STR_t e)
 {
     while(s < e)
     {
         if(*s == '&')
         {
-            s++;
+            size_t size = xml_entity(p++, s, e);
 
-            size_t size = (size_t) e - (size_t) s;
-
-            /**/ if(size >= 3 && strncmp(s, "lt;", 3) == 0)
-            {
-                *p++ = '<';
-                s += 3;
-            }
-            else if(size >= 3 && strncmp(s, "gt;", 3) == 0)
-            {
-                *p++ = '>';
-                s += 3;
-            }
-            else if(size >= 4 && strncmp(s, "amp;", 4) == 0)
-            {
-                *p++ = '&';
-                s += 4;
-            }
-            else if(size >= 5 && strncmp(s, "quot;", 5) == 0)
-            {
-                *p++ = '\"';
-                s += 5;
-            }
-            else if(size >= 5 && strncmp(s, "apos;", 5) == 0)
-            {
-                *p++ = '\'';
-                s += 5;
-            }
-            else
+            if(size == 0)
             {
                 return false;
             }
+
+            s += size;
         }
         else
         {
@@ -141,6 +159,29 @@ static bool xmlcpy(str_t p, STR_t s, STR_t e)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/* Validates the entities like xmlcpy() without decoding, for the tokens that lazy parsing skips. */
+
+static bool xmlchk(STR_t s, STR_t e)
+{
+    char c;
+
+    while(s < e && (s = memchr(s, '&', (size_t) e - (size_t) s)) != NULL)
+    {
+        size_t size = xml_entity(&c, s, e);
+
+        if(size == 0)
+        {
+            return false;
+        }
+
+        s += size;
+    }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 static void tokenizer_next(xml_parser_t *parser)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -400,34 +441,43 @@ static void tokenizer_next(xml_parser_t *parser)
 
     /**/ if(type == XML_TOKEN_COMMENT) // <!-- ... -->
     {
-        STR_t s = start + 4;
-        STR_t e =  end  - 3;
+        STR_t s = parser->curr_token.s = start + 4;
+        STR_t e = parser->curr_token.e =  end  - 3;
 
-        parser->curr_token.value = nyx_string_ndup(s, (size_t) e - (size_t) s);
+        if(parser->lazy == false)
+        {
+            parser->curr_token.value = nyx_string_ndup(s, (size_t) e - (size_t) s);
+        }
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     else if(type == XML_TOKEN_CDATA) // <![CDATA[ ... ]]>
     {
-        STR_t s = start + 9;
-        STR_t e =  end  - 3;
+        STR_t s = parser->curr_token.s = start + 9;
+        STR_t e = parser->curr_token.e =  end  - 3;
 
-        parser->curr_token.value = nyx_string_ndup(s, (size_t) e - (size_t) s);
+        if(parser->lazy == false)
+        {
+            parser->curr_token.value = nyx_string_ndup(s, (size_t) e - (size_t) s);
+        }
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
     else if(type == XML_TOKEN_IDENT)
     {
-        STR_t s = start;
-        STR_t e =  end ;
+        STR_t s = parser->curr_token.s = start;
+        STR_t e = parser->curr_token.e =  end ;
 
         size_t length = (size_t) e - (size_t) s;
 
         if(length > 0)
         {
-            parser->curr_token.value = nyx_string_ndup(s, length);
+            if(parser->lazy == false)
+            {
+                parser->curr_token.value = nyx_string_ndup(s, length);
+            }
         }
         else
         {
@@ -439,19 +489,22 @@ static void tokenizer_next(xml_parser_t *parser)
 
     else if(type == XML_TOKEN_STRING)
     {
-        STR_t s = start + 1;
-        STR_t e =  end  - 1;
+        STR_t s = parser->curr_token.s = start + 1;
+        STR_t e = parser->curr_token.e =  end  - 1;
 
         size_t length = (size_t) e - (size_t) s;
 
-        str_t p = parser->curr_token.value = nyx_memory_alloc(length + 1);
-
-        if(xmlcpy(p, s, e) == false)
+        if(parser->lazy == false)
         {
-            nyx_memory_free(parser->curr_token.value);
-            parser->curr_token.value = NULL;
-            type = XML_TOKEN_ERROR;
-            goto _bye;
+            str_t p = parser->curr_token.value = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, length + 1);
+
+            if(xmlcpy(p, s, e) == false)
+            {
+                nyx_memory_free(parser->curr_token.value);
+                parser->curr_token.value = NULL;
+                type = XML_TOKEN_ERROR;
+                goto _bye;
+            }
         }
     }
 
@@ -459,14 +512,14 @@ static void tokenizer_next(xml_parser_t *parser)
 
     else if(type == XML_TOKEN_TEXT)
     {
-        STR_t s = start;
-        STR_t e =  end ;
+        STR_t s = parser->curr_token.s = start;
+        STR_t e = parser->curr_token.e =  end ;
 
         size_t length = (size_t) e - (size_t) s;
 
-        if(length > 0)
+        if(length > 0 && parser->lazy == false)
         {
-            str_t p = parser->curr_token.value = nyx_memory_alloc(length + 1);
+            str_t p = parser->curr_token.value = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, length + 1);
 
             if(xmlcpy(p, s, e) == false)
             {
@@ -476,7 +529,7 @@ static void tokenizer_next(xml_parser_t *parser)
                 goto _bye;
             }
         }
-        else
+        else if(length == 0)
         {
             type = XML_TOKEN_ERROR;
         }
@@ -873,10 +926,13 @@ nyx_xmldoc_t *nyx_xmldoc_parse_buff(size_t size, BUFF_t buff)
 
     xml_parser_t *parser = &(xml_parser_t) {
         .tag = false,
+        .lazy = false,
         .size = size,
         .buff = buff,
         .curr_token = {
             .value = NULL,
+            .s = NULL,
+            .e = NULL,
             .token_type = XML_TOKEN_ERROR,
         },
     };
@@ -925,6 +981,351 @@ nyx_xmldoc_t *nyx_xmldoc_parse(STR_t string)
     );
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* OBJECT PARSER                                                                                                      */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static str_t object_decode(STR_t s, STR_t e, bool trim)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t result = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, (size_t) e - (size_t) s + 1);
+
+    if(xmlcpy(result, s, e) == false)
+    {
+        nyx_memory_free(result);
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(trim)
+    {
+        size_t length = strlen(result);
+
+        STR_t content_s = internal_xml_trim(result, &length);
+
+        memmove(result, content_s, length);
+
+        result[length] = '\0';
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_dict_t *object_parse_element(xml_parser_t *parser) // NOLINT(*-no-recursion)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* OPENING TAG                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(CHECK(XML_TOKEN_LT1) == false)
+    {
+        return NULL;
+    }
+
+    NEXT();
+
+    if(CHECK(XML_TOKEN_IDENT) == false)
+    {
+        return NULL;
+    }
+
+    STR_t name_s = PEEK().s;
+    size_t name_len = (size_t) PEEK().e - (size_t) PEEK().s;
+
+    NEXT();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *result = nyx_dict_new();
+
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), nyx_string_ndup(name_s, name_len), true);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* ATTRIBUTES                                                                                                     */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Attributes are decoded after the content to keep the key order of nyx_xmldoc_to_object(). */
+
+    xml_parser_t attributes = *parser;
+
+    while(CHECK(XML_TOKEN_IDENT))
+    {
+        NEXT();
+
+        if(CHECK(XML_TOKEN_EQUALS) == false)
+        {
+            goto _err;
+        }
+
+        NEXT();
+
+        if(CHECK(XML_TOKEN_STRING) == false)
+        {
+            goto _err;
+        }
+
+        NEXT();
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    bool self_closing = CHECK(XML_TOKEN_SLASH);
+
+    if(self_closing)
+    {
+        NEXT();
+    }
+
+    if(CHECK(XML_TOKEN_GT) == false)
+    {
+        goto _err;
+    }
+
+    NEXT();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* CONTENT                                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t text = NULL;
+
+    bool has_text = false;
+
+    nyx_list_t *list = NULL;
+
+    while(self_closing == false)
+    {
+        /**/ if(CHECK(XML_TOKEN_LT1))
+        {
+            nyx_dict_t *child = object_parse_element(parser);
+
+            if(child == NULL)
+            {
+                goto _err_content;
+            }
+
+            if(list == NULL)
+            {
+                list = nyx_list_new();
+            }
+
+            nyx_list_push(list, child);
+
+            nyx_object_unref(child);
+        }
+        else if(CHECK(XML_TOKEN_TEXT))
+        {
+            /* Only the first text node is kept, as with nyx_xmldoc_to_object(). */
+
+            if(has_text == false)
+            {
+                has_text = true;
+
+                text = object_decode(PEEK().s, PEEK().e, true);
+
+                if(text == NULL)
+                {
+                    goto _err_content;
+                }
+            }
+            else if(xmlchk(PEEK().s, PEEK().e) == false)
+            {
+                goto _err_content;
+            }
+
+            NEXT();
+        }
+        else if(CHECK(XML_TOKEN_COMMENT) || CHECK(XML_TOKEN_CDATA))
+        {
+            NEXT();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* CLOSING TAG                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(self_closing == false)
+    {
+        if(CHECK(XML_TOKEN_LT2) == false)
+        {
+            goto _err_content;
+        }
+
+        NEXT();
+
+        if(CHECK(XML_TOKEN_IDENT) == false || (size_t) PEEK().e - (size_t) PEEK().s != name_len || memcmp(PEEK().s, name_s, name_len) != 0)
+        {
+            goto _err_content;
+        }
+
+        NEXT();
+
+        if(CHECK(XML_TOKEN_GT) == false)
+        {
+            goto _err_content;
+        }
+
+        NEXT();
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* BUILD OBJECT                                                                                                   */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(text != NULL)
+    {
+        if(text[0] != '\0')
+        {
+            nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), text, true);
+        }
+        else
+        {
+            nyx_memory_free(text);
+        }
+
+        text = NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    xml_parser_t content = *parser;
+
+    *parser = attributes;
+
+    while(CHECK(XML_TOKEN_IDENT))
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        /* Attribute names come from the peer, only the short ones are built on the stack. */
+
+        char key_buff[64];
+
+        size_t key_len = (size_t) PEEK().e - (size_t) PEEK().s;
+
+        str_t key = key_len + 2 <= sizeof(key_buff) ? key_buff : nyx_memory_alloc(key_len + 2);
+
+        key[0] = '@';
+
+        memcpy(key + 1, PEEK().s, key_len);
+
+        key[key_len + 1] = '\0';
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        NEXT();
+        NEXT();
+
+        str_t value = object_decode(PEEK().s, PEEK().e, false);
+
+        if(value != NULL)
+        {
+            nyx_dict_set_string_unref(result, key, value, true);
+        }
+
+        if(key != key_buff)
+        {
+            nyx_memory_free(key);
+        }
+
+        if(value == NULL)
+        {
+            goto _err_content;
+        }
+
+        NEXT();
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    *parser = content;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(list != NULL)
+    {
+        nyx_dict_set(result, NYX_ATOM(CHILDREN), list);
+
+        nyx_object_unref(list);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result;
+
+_err_content:
+    nyx_memory_free(text);
+
+    if(list != NULL)
+    {
+        nyx_object_unref(list);
+    }
+
+_err:
+    nyx_object_unref(result);
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_object_t *nyx_xml_buff_to_object(size_t size, BUFF_t buff)
+{
+    if(size == 0x00
+       ||
+       buff == NULL
+    ) {
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    xml_parser_t *parser = &(xml_parser_t) {
+        .tag = false,
+        .lazy = true,
+        .size = size,
+        .buff = buff,
+        .curr_token = {
+            .value = NULL,
+            .s = NULL,
+            .e = NULL,
+            .token_type = XML_TOKEN_ERROR,
+        },
+    };
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    NEXT();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *result = object_parse_element(parser);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(result != NULL && CHECK(XML_TOKEN_EOF) == false)
+    {
+        nyx_object_unref(result);
+
+        result = NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return (nyx_object_t *) result;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 #endif
 /*--------------------------------------------------------------------------------------------------------------------*/
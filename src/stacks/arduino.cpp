@@ -66,6 +66,8 @@ struct nyx_stack_s
     IPAddress stream_ip;
     int stream_port = 6379;
 
+    nyx_stream_stats_t stream_stats = {};
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
     nyx_stack_s(): mqtt_client(tcp_client) {}
@@ -174,14 +176,56 @@ void internal_mqtt_pub(nyx_node_t *node, nyx_str_t topic, nyx_str_t message, __N
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-void internal_stream_pub(nyx_node_t *node, nyx_str_t message)
+void internal_stream_pub(const nyx_node_t *node, nyx_str_t message)
+{
+    internal_stream_pubv(node, 1, &message);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_stream_pubv(const nyx_node_t *node, size_t n_messages, const nyx_str_t messages[])
 {
     auto stack = node->stack;
 
+    /* Client writes are synchronous here, there is no send buffer to apply the watermarks to. */
+
     if(stack->stream_client.connected())
     {
-        stack->stream_client.write(message.buf, message.len);
+        size_t total = 0;
+        size_t sent = 0;
+
+        for(size_t i = 0; i < n_messages; i++)
+        {
+            total += messages[i].len;
+
+            sent += stack->stream_client.write((const uint8_t *) messages[i].buf, messages[i].len);
+        }
+
+        if(sent < total)
+        {
+            stack->stream_stats.dropped_frames += 1;
+            stack->stream_stats.dropped_bytes += total - sent;
+
+            stack->stream_client.stop(); /* the frame is truncated */
+
+            return false;
+        }
+
+        stack->stream_stats.queued_frames += 1;
+
+        return true;
     }
+
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_node_stream_stats(const nyx_node_t *node, nyx_stream_stats_t *stats)
+{
+    *stats = node->stack->stream_stats;
+
+    stats->pending_bytes = 0;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -461,6 +505,13 @@ void internal_stack_finalize(__NYX_UNUSED__ nyx_node_t *node)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+uint64_t internal_get_millis(void)
+{
+    return millis();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 struct _timer_ctx_s
 {
     void (* callback)(void *arg);
@@ -512,6 +563,8 @@ void nyx_node_poll(nyx_node_t *node, uint32_t timeout_ms)
 
         node->stack->mqtt_client.loop();
 
+        internal_notify_flush(node);
+
         delay(timeout_ms == 0 ? timeout_ms : 10);
     }
 }
@@ -13,19 +13,78 @@
 
 #include "external/mongoose.h"
 
+#if MG_ENABLE_SOCKET && MG_ARCH == MG_ARCH_UNIX
+#  include <poll.h>
+#  include <errno.h>
+#  include <limits.h>
+#  include <sys/uio.h>
+#endif
+
 #include "../nyx_node_internal.h"
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+typedef struct
+{
+    size_t ref;
+    size_t len;
+
+    char buf[];
+
+} indi_message_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    struct mg_connection *connection;
+
+    indi_message_t **messages;              /* Messages waiting to be sent, oldest first, shared between clients. */
+
+    size_t messages_head;
+    size_t messages_size;
+    size_t messages_capacity;
+
+    size_t messages_offset;                 /* Bytes of the oldest message already sent. */
+    size_t messages_bytes;
+
+    nyx_xml_stream_t xml_stream;            /* Framing state of the received data. */
+
+} indi_client_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 struct nyx_stack_s
 {
     struct mg_mgr mgr;
 
     struct mg_mqtt_opts mqtt_opts;
 
-    struct mg_connection *indi_connection;
+    struct mg_connection *indi_listener;
     struct mg_connection *mqtt_connection;
     struct mg_connection *stream_connection;
+
+    /**/
+
+    size_t *stream_frames;                  /* Unsent bytes of each frame in the stream send buffer, oldest first. */
+
+    size_t stream_frames_head;
+    size_t stream_frames_size;
+    size_t stream_frames_capacity;
+
+    size_t stream_frames_bytes;
+
+    bool stream_head_started;
+    bool stream_congested;
+
+    nyx_stream_stats_t stream_stats;
+
+    /**/
+
+    indi_client_t *indi_clients;
+
+    size_t indi_clients_size;
+    size_t indi_clients_capacity;
 };
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -85,19 +144,283 @@ void nyx_log(nyx_log_level_t level, STR_t file, STR_t func, int line, STR_t fmt,
     }
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* INDI CLIENTS                                                                                                       */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ indi_message_t **_indi_message(const indi_client_t *client, size_t idx)
+{
+    return &client->messages[(client->messages_head + idx) % client->messages_capacity];
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_message_unref(indi_message_t *message)
+{
+    if(--message->ref == 0)
+    {
+        nyx_memory_free(message);
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_client_push(indi_client_t *client, indi_message_t *message)
+{
+    if(client->messages_size == client->messages_capacity)
+    {
+        size_t capacity = client->messages_capacity == 0 ? 16 : 2 * client->messages_capacity;
+
+        indi_message_t **messages = nyx_memory_alloc(capacity * sizeof(indi_message_t *));
+
+        for(size_t i = 0; i < client->messages_size; i++)
+        {
+            messages[i] = *_indi_message(client, i);
+        }
+
+        nyx_memory_free(client->messages);
+
+        client->messages = messages;
+        client->messages_head = 0;
+        client->messages_capacity = capacity;
+    }
+
+    *_indi_message(client, client->messages_size++) = message;
+
+    client->messages_bytes += message->len;
+
+    message->ref++;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_client_pop(indi_client_t *client, size_t len)
+{
+    client->messages_bytes -= len;
+
+    while(len > 0)
+    {
+        indi_message_t *message = *_indi_message(client, 0);
+
+        size_t remaining = message->len - client->messages_offset;
+
+        if(remaining <= len)
+        {
+            len -= remaining;
+
+            _indi_message_unref(message);
+
+            client->messages_head = (client->messages_head + 1) % client->messages_capacity;
+            client->messages_size--;
+
+            client->messages_offset = 0;
+        }
+        else
+        {
+            client->messages_offset += len;
+
+            len = 0;
+        }
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_client_flush(indi_client_t *client)
+{
+    struct mg_connection *connection = client->connection;
+
+    if(client->messages_size == 0 || connection->is_closing != 0)
+    {
+        return;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* VECTORED WRITE FROM THE SHARED BUFFERS                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if MG_ENABLE_SOCKET && MG_ARCH == MG_ARCH_UNIX
+
+    if(connection->is_tls == 0 && connection->send.len == 0)
+    {
+        while(client->messages_size > 0)
+        {
+            struct iovec iov[64];
+
+            size_t n_iov = client->messages_size < 64 ? client->messages_size : 64;
+
+            for(size_t i = 0; i < n_iov; i++)
+            {
+                indi_message_t *message = *_indi_message(client, i);
+
+                size_t offset = i == 0 ? client->messages_offset : 0;
+
+                iov[i].iov_base = message->buf + offset;
+                iov[i].iov_len = message->len - offset;
+            }
+
+            ssize_t n;
+
+            do
+            {
+                n = writev((int) (size_t) connection->fd, iov, (int) n_iov);
+
+            } while(n < 0 && errno == EINTR);
+
+            if(n <= 0)
+            {
+                if(n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+                {
+                    NYX_LOG_ERROR("%lu Cannot send message to INDI", connection->id);
+
+                    connection->is_closing = 1;
+                }
+
+                break;
+            }
+
+            _indi_client_pop(client, (size_t) n);
+        }
+
+        return;
+    }
+
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* COPY INTO THE CONNECTION                                                                                       */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(client->messages_size > 0)
+    {
+        indi_message_t *message = *_indi_message(client, 0);
+
+        size_t len = message->len - client->messages_offset;
+
+        if(!mg_send(connection, message->buf + client->messages_offset, len))
+        {
+            NYX_LOG_ERROR("%lu Cannot send message to INDI", connection->id);
+
+            break;
+        }
+
+        _indi_client_pop(client, len);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static indi_client_t *_indi_client_get(const nyx_stack_t *stack, const struct mg_connection *connection)
+{
+    for(size_t i = 0; i < stack->indi_clients_size; i++)
+    {
+        if(stack->indi_clients[i].connection == connection)
+        {
+            return &stack->indi_clients[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_client_add(nyx_stack_t *stack, struct mg_connection *connection)
+{
+    if(stack->indi_clients_size == stack->indi_clients_capacity)
+    {
+        stack->indi_clients_capacity = stack->indi_clients_capacity == 0 ? 4 : 2 * stack->indi_clients_capacity;
+
+        stack->indi_clients = nyx_memory_realloc(stack->indi_clients, stack->indi_clients_capacity * sizeof(indi_client_t));
+    }
+
+    indi_client_t *client = &stack->indi_clients[stack->indi_clients_size++];
+
+    memset(client, 0x00, sizeof(indi_client_t));
+
+    client->connection = connection;
+
+    client->xml_stream = NYX_XML_STREAM();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _indi_client_del(nyx_stack_t *stack, const struct mg_connection *connection)
+{
+    indi_client_t *client = _indi_client_get(stack, connection);
+
+    if(client != NULL)
+    {
+        for(size_t i = 0; i < client->messages_size; i++)
+        {
+            _indi_message_unref(*_indi_message(client, i));
+        }
+
+        nyx_memory_free(client->messages);
+
+        *client = stack->indi_clients[--stack->indi_clients_size];
+    }
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* INDI, MQTT & NSS                                                                                                   */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-void internal_indi_pub(const nyx_node_t *node, nyx_str_t message)
+void internal_indi_pub(const nyx_node_t *node, nyx_str_t message, const void *target)
 {
-    if(node->stack->indi_connection != NULL)
+    nyx_stack_t *stack = node->stack;
+
+    if(stack->indi_clients_size == 0 || message.len == 0)
+    {
+        return;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* The message is copied once and shared by all the clients. */
+
+    indi_message_t *shared = nyx_memory_alloc(sizeof(indi_message_t) + message.len);
+
+    shared->ref = 1;
+    shared->len = message.len;
+
+    memcpy(shared->buf, message.buf, message.len);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(size_t i = 0; i < stack->indi_clients_size; i++)
     {
-        if(!mg_send(node->stack->indi_connection, message.buf, message.len))
+        indi_client_t *client = &stack->indi_clients[i];
+
+        if(target != NULL && target != client->connection)
+        {
+            continue;
+        }
+
+        if(client->connection->is_closing == 0)
         {
-            NYX_LOG_ERROR("Cannot send message to INDI");
+            if(client->messages_bytes + client->connection->send.len + message.len > NYX_INDI_MAX_QUEUE_SIZE)
+            {
+                NYX_LOG_ERROR("%lu INDI client is too slow, disconnecting", client->connection->id);
+
+                client->connection->is_closing = 1;
+
+                continue;
+            }
+
+            _indi_client_push(client, shared);
+
+            _indi_client_flush(client);
         }
     }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    _indi_message_unref(shared);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -132,17 +455,383 @@ void internal_mqtt_pub(const nyx_node_t *node, nyx_str_t topic, nyx_str_t messag
     }
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* STREAM BACKPRESSURE                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ size_t *_stream_frame(const nyx_stack_t *stack, size_t idx)
+{
+    return &stack->stream_frames[(stack->stream_frames_head + idx) % stack->stream_frames_capacity];
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stream_reset(nyx_stack_t *stack)
+{
+    stack->stream_frames_head = 0;
+    stack->stream_frames_size = 0;
+
+    stack->stream_frames_bytes = 0;
+
+    stack->stream_head_started = false;
+    stack->stream_congested = false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stream_push(nyx_stack_t *stack, size_t len)
+{
+    if(stack->stream_frames_size == stack->stream_frames_capacity)
+    {
+        size_t capacity = stack->stream_frames_capacity == 0 ? 16 : 2 * stack->stream_frames_capacity;
+
+        size_t *frames = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STREAM, capacity * sizeof(size_t));
+
+        for(size_t i = 0; i < stack->stream_frames_size; i++)
+        {
+            frames[i] = *_stream_frame(stack, i);
+        }
+
+        nyx_memory_free(stack->stream_frames);
+
+        stack->stream_frames = frames;
+        stack->stream_frames_head = 0;
+        stack->stream_frames_capacity = capacity;
+    }
+
+    *_stream_frame(stack, stack->stream_frames_size++) = len;
+
+    stack->stream_frames_bytes += len;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stream_sync(nyx_stack_t *stack, const struct mg_connection *connection)
+{
+    /* Mongoose only ever removes bytes from the front of the send buffer, whatever it sent is subtracted from the oldest frames. */
+
+    size_t drained = stack->stream_frames_bytes > connection->send.len ? stack->stream_frames_bytes - connection->send.len : 0;
+
+    while(drained > 0 && stack->stream_frames_size > 0)
+    {
+        size_t *frame = _stream_frame(stack, 0);
+
+        if(*frame <= drained)
+        {
+            drained -= *frame;
+
+            stack->stream_frames_head = (stack->stream_frames_head + 1) % stack->stream_frames_capacity;
+            stack->stream_frames_size--;
+
+            stack->stream_head_started = false;
+        }
+        else
+        {
+            *frame -= drained;
+
+            drained = 0;
+
+            stack->stream_head_started = true;
+        }
+    }
+
+    stack->stream_frames_bytes = connection->send.len;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stream_drop_oldest(nyx_stack_t *stack, struct mg_connection *connection, size_t low_watermark)
+{
+    /* A partially sent frame must be completed, otherwise the stream would be corrupted. */
+
+    size_t first = stack->stream_head_started ? 1 : 0;
+
+    size_t offset = first > 0 ? *_stream_frame(stack, 0) : 0;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t n = 0;
+    size_t len = 0;
+
+    while(first + n < stack->stream_frames_size && connection->send.len - len > low_watermark)
+    {
+        len += *_stream_frame(stack, first + n++);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(n > 0)
+    {
+        mg_iobuf_del(&connection->send, offset, len);
+
+        if(first > 0)
+        {
+            *_stream_frame(stack, n) = *_stream_frame(stack, 0);
+        }
+
+        stack->stream_frames_head = (stack->stream_frames_head + n) % stack->stream_frames_capacity;
+        stack->stream_frames_size -= n;
+
+        stack->stream_frames_bytes -= len;
+
+        stack->stream_stats.dropped_frames += n;
+        stack->stream_stats.dropped_bytes += len;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stream_flush(struct mg_connection *connection, size_t low_watermark)
+{
+    #if MG_ENABLE_SOCKET && MG_ARCH == MG_ARCH_UNIX
+
+    if(connection->is_tls != 0 || connection->is_connecting != 0 || connection->is_resolving != 0)
+    {
+        return;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    uint64_t deadline = mg_millis() + NYX_STREAM_BLOCK_TIMEOUT_MS;
+
+    while(connection->send.len > low_watermark)
+    {
+        long n = mg_io_send(connection, connection->send.buf, connection->send.len);
+
+        if(n > 0)
+        {
+            mg_iobuf_del(&connection->send, 0, (size_t) n);
+
+            continue;
+        }
+
+        if(n != MG_IO_WAIT)
+        {
+            NYX_LOG_ERROR("Cannot send message to Nyx-Stream");
+
+            connection->is_closing = 1;
+
+            return;
+        }
+
+        uint64_t now = mg_millis();
+
+        if(now >= deadline)
+        {
+            return;
+        }
+
+        struct pollfd pfd = {.fd = (int) (size_t) connection->fd, .events = POLLOUT, .revents = 0};
+
+        poll(&pfd, 1, (int) (deadline - now));
+    }
+
+    #else
+
+    (void) connection;
+    (void) low_watermark;
+
+    #endif
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+void nyx_node_stream_stats(const nyx_node_t *node, nyx_stream_stats_t *stats)
+{
+    *stats = node->stack->stream_stats;
+
+    stats->pending_bytes = node->stack->stream_connection != NULL ? node->stack->stream_connection->send.len : 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* STREAM                                                                                                             */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
 void internal_stream_pub(const nyx_node_t *node, nyx_str_t message)
 {
-    if(node != NULL && node->stack->stream_connection != NULL)
+    internal_stream_pubv(node, 1, &message);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_stream_pubv(const nyx_node_t *node, size_t n_messages, const nyx_str_t messages[])
+{
+    struct mg_connection *connection = node != NULL ? node->stack->stream_connection : NULL;
+
+    if(connection == NULL || connection->is_closing != 0)
+    {
+        return false;
+    }
+
+    nyx_stack_t *stack = node->stack;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t total = 0;
+
+    for(size_t i = 0; i < n_messages; i++)
+    {
+        total += messages[i].len;
+    }
+
+    if(total == 0)
+    {
+        return true;
+    }
+
+    size_t sent = 0;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* BACKPRESSURE                                                                                                   */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    _stream_sync(stack, connection);
+
+    if(stack->stream_congested == false && connection->send.len > 0 && connection->send.len + total > node->stream_high_watermark)
+    {
+        stack->stream_congested = true;
+    }
+
+    if(stack->stream_congested)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        /**/ if(node->stream_policy == NYX_STREAM_POLICY_DROP_OLDEST)
+        {
+            _stream_drop_oldest(stack, connection, node->stream_low_watermark);
+        }
+        else if(node->stream_policy == NYX_STREAM_POLICY_BLOCK)
+        {
+            _stream_flush(connection, node->stream_low_watermark);
+
+            _stream_sync(stack, connection);
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(connection->is_closing != 0)
+        {
+            return false;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(connection->send.len <= node->stream_low_watermark)
+        {
+            stack->stream_congested = false;
+        }
+        else if(node->stream_policy != NYX_STREAM_POLICY_DROP_OLDEST)
+        {
+            stack->stream_stats.dropped_frames += 1;
+            stack->stream_stats.dropped_bytes += total;
+
+            return false;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* VECTORED WRITE                                                                                                 */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if MG_ENABLE_SOCKET && MG_ARCH == MG_ARCH_UNIX
+
+    /* Writing directly is only allowed when nothing is pending, otherwise the frame would overtake queued data. */
+
+    if(connection->send.len == 0 && connection->is_tls == 0 && connection->is_connecting == 0 && connection->is_resolving == 0 && connection->is_closing == 0)
     {
-        if(!mg_send(node->stack->stream_connection, message.buf, message.len))
+        /* Messages beyond the iovec array are queued below, like the unsent bytes of a partial write. */
+
+        struct iovec iov[1 + 2 * NYX_STREAM_MAX_FIELDS];
+
+        #ifdef IOV_MAX
+        size_t max_iov = sizeof(iov) / sizeof(struct iovec) < IOV_MAX ? sizeof(iov) / sizeof(struct iovec) : IOV_MAX;
+        #else
+        size_t max_iov = sizeof(iov) / sizeof(struct iovec) < 16 ? sizeof(iov) / sizeof(struct iovec) : 16;
+        #endif
+
+        size_t n_iov = n_messages < max_iov ? n_messages : max_iov;
+
+        for(size_t i = 0; i < n_iov; i++)
+        {
+            iov[i].iov_base = messages[i].buf;
+            iov[i].iov_len = messages[i].len;
+        }
+
+        ssize_t n;
+
+        do
+        {
+            n = writev((int) (size_t) connection->fd, iov, (int) n_iov);
+
+        } while(n < 0 && errno == EINTR);
+
+        if(n > 0)
+        {
+            sent = (size_t) n;
+        }
+
+        /* On error, the whole frame is queued and Mongoose reports the failure on its next write. */
+    }
+
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* QUEUE THE REMAINDER                                                                                            */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(sent < total)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(connection->send.size - connection->send.len < total - sent && mg_iobuf_resize(&connection->send, connection->send.len + total - sent) == 0)
         {
             NYX_LOG_ERROR("Cannot send message to Nyx-Stream");
+
+            if(sent > 0)
+            {
+                connection->is_closing = 1; /* part of the frame is already out */
+            }
+
+            return false;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(sent > 0)
+        {
+            stack->stream_head_started = true; /* the send buffer was empty, this frame is the head */
+        }
+
+        _stream_push(stack, total - sent);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        for(size_t i = 0; i < n_messages; i++)
+        {
+            if(sent >= messages[i].len)
+            {
+                sent -= messages[i].len;
+            }
+            else
+            {
+                mg_send(connection, messages[i].buf + sent, messages[i].len - sent);
+
+                sent = 0;
+            }
         }
+
+        /*------------------------------------------------------------------------------------------------------------*/
     }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    stack->stream_stats.queued_frames += 1;
+
+    return true;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -155,34 +844,67 @@ static void _indi_handler(struct mg_connection *connection, int ev, void *ev_dat
 
     /**/ if(ev == MG_EV_OPEN)
     {
-        NYX_LOG_INFO("%lu INDI OPEN", connection->id);
+        if(connection->is_listening != 0)
+        {
+            NYX_LOG_INFO("%lu INDI OPEN", connection->id);
+
+            node->stack->indi_listener = connection;
+        }
+    }
+    else if(ev == MG_EV_ACCEPT)
+    {
+        NYX_LOG_INFO("%lu INDI ACCEPT", connection->id);
 
-        node->stack->indi_connection = connection;
+        _indi_client_add(node->stack, connection);
     }
     else if(ev == MG_EV_CLOSE)
     {
         NYX_LOG_INFO("%lu INDI CLOSE", connection->id);
 
-        node->stack->indi_connection = NULL;
+        if(connection->is_listening != 0)
+        {
+            node->stack->indi_listener = NULL;
+        }
+        else
+        {
+            _indi_client_del(node->stack, connection);
+        }
     }
     else if(ev == MG_EV_ERROR)
     {
         NYX_LOG_ERROR("%lu INDI ERROR %s", connection->id, (STR_t) ev_data);
     }
+    else if(ev == MG_EV_POLL)
+    {
+        if(connection->is_accepted != 0)
+        {
+            indi_client_t *client = _indi_client_get(node->stack, connection);
+
+            if(client != NULL)
+            {
+                _indi_client_flush(client);
+            }
+        }
+    }
     else if(ev == MG_EV_READ)
     {
-        size_t consumed = node->tcp_handler(node, NYX_NODE_EVENT_MSG, NYX_STR_S(connection->recv.buf, connection->recv.len));
+        indi_client_t *client = _indi_client_get(node->stack, connection);
 
-        if(consumed > connection->recv.len)
+        if(client != NULL)
         {
-            consumed = connection->recv.len;
-        }
+            size_t consumed = node->tcp_handler(node, NYX_NODE_EVENT_MSG, connection, &client->xml_stream, NYX_STR_S(connection->recv.buf, connection->recv.len));
 
-        mg_iobuf_del(
-            &connection->recv,
-            0x0000000000,
-            consumed
-        );
+            if(consumed > connection->recv.len)
+            {
+                consumed = connection->recv.len;
+            }
+
+            mg_iobuf_del(
+                &connection->recv,
+                0x0000000000,
+                consumed
+            );
+        }
     }
 }
 
@@ -243,12 +965,16 @@ static void _stream_handler(struct mg_connection *connection, int ev, void *ev_d
         NYX_LOG_INFO("%lu STREAM OPEN", connection->id);
 
         node->stack->stream_connection = connection;
+
+        _stream_reset(node->stack);
     }
     else if(ev == MG_EV_CLOSE)
     {
         NYX_LOG_INFO("%lu STREAM CLOSE", connection->id);
 
         node->stack->stream_connection = NULL;
+
+        _stream_reset(node->stack);
     }
     else if(ev == MG_EV_ERROR)
     {
@@ -276,16 +1002,16 @@ static void _retry_timer_handler(void *arg)
     /* INDI                                                                                                           */
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    if(stack->indi_connection == NULL && node->indi_url != NULL && node->indi_url[0] != '\0')
+    if(stack->indi_listener == NULL && node->indi_url != NULL && node->indi_url[0] != '\0')
     {
-        stack->indi_connection = mg_listen(
+        stack->indi_listener = mg_listen(
             &stack->mgr,
             node->indi_url,
             _indi_handler,
             node
         );
 
-        if(stack->indi_connection != NULL)
+        if(stack->indi_listener != NULL)
         {
             NYX_LOG_INFO("INDI support is enabled");
         }
@@ -382,11 +1108,22 @@ void internal_stack_finalize(const nyx_node_t *node)
 {
     mg_mgr_free(&node->stack->mgr);
 
+    nyx_memory_free(node->stack->stream_frames);
+
+    nyx_memory_free(node->stack->indi_clients);
+
     nyx_memory_free(node->stack);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+uint64_t internal_get_millis(void)
+{
+    return mg_millis();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 void nyx_node_add_timer(const nyx_node_t *node, uint32_t interval_ms, void(* callback)(void *), void *arg)
 {
     mg_timer_add(&node->stack->mgr, interval_ms, MG_TIMER_REPEAT | MG_TIMER_RUN_NOW, callback, arg);
@@ -397,6 +1134,8 @@ void nyx_node_add_timer(const nyx_node_t *node, uint32_t interval_ms, void(* cal
 void nyx_node_poll(const nyx_node_t *node, uint32_t timeout_ms)
 {
     mg_mgr_poll(&node->stack->mgr, timeout_ms == 0 ? (int) timeout_ms : 10);
+
+    internal_notify_flush(node);
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -11,15 +11,75 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-typedef struct nyx_string_builder_node_s
+#define NYX_SB_MIN_CAPACITY 64
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ void _reserve(nyx_string_builder_t *sb, size_t len)
+{
+    if(sb->len + len > sb->capacity)
+    {
+        size_t capacity = sb->capacity > 0 ? sb->capacity : NYX_SB_MIN_CAPACITY;
+
+        while(sb->len + len > capacity)
+        {
+            capacity *= 2;
+        }
+
+        sb->buff = nyx_memory_category_realloc(NYX_MEMORY_CATEGORY_BUILDER, sb->buff, capacity);
+
+        sb->capacity = capacity;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ void _append(nyx_string_builder_t *sb, size_t len, STR_t str)
 {
-    size_t len;
+    if(len > 0)
+    {
+        _reserve(sb, len);
+
+        memcpy(sb->buff + sb->len, str, len);
+
+        sb->len += len;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-    uint32_t flags;
+__NYX_INLINE__ STR_t _escape(char c, uint32_t flags)
+{
+    if((flags & NYX_SB_ESCAPE_XML) != 0)
+    {
+        switch(c)
+        {
+            case '<': return "&lt;";
+            case '>': return "&gt;";
+            case '&': return "&amp;";
+            case '\"': return "&quot;";
+            case '\'': return "&apos;";
+            default: break;
+        }
+    }
 
-    struct nyx_string_builder_node_s *next;
+    if((flags & NYX_SB_ESCAPE_JSON) != 0)
+    {
+        switch(c)
+        {
+            case '\"': return "\\\"";
+            case '\\': return "\\\\";
+            case '\b': return "\\b";
+            case '\f': return "\\f";
+            case '\n': return "\\n";
+            case '\r': return "\\r";
+            case '\t': return "\\t";
+            default: break;
+        }
+    }
 
-} node_t;
+    return NULL;
+}
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
@@ -27,12 +87,13 @@ nyx_string_builder_t *nyx_string_builder_new()
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_string_builder_t *sb = nyx_memory_alloc(sizeof(nyx_string_builder_t));
+    nyx_string_builder_t *sb = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BUILDER, sizeof(nyx_string_builder_t));
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    sb->head = NULL;
-    sb->tail = NULL;
+    sb->buff = NULL;
+    sb->len = 0;
+    sb->capacity = 0;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -52,29 +113,28 @@ void nyx_string_builder_free(nyx_string_builder_t *sb)
 
 void nyx_string_builder_clear(nyx_string_builder_t *sb)
 {
-    /*----------------------------------------------------------------------------------------------------------------*/
+    nyx_memory_free(sb->buff);
 
-    for(node_t *node = sb->head; node != NULL;)
-    {
-        /*------------------------------------------------------------------------------------------------------------*/
-
-        node_t *temp = node;
+    sb->buff = NULL;
+    sb->len = 0;
+    sb->capacity = 0;
+}
 
-        node = node->next;
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-        /*------------------------------------------------------------------------------------------------------------*/
+void nyx_string_builder_reset(nyx_string_builder_t *sb)
+{
+    sb->len = 0;
+}
 
-        nyx_memory_free(temp);
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-        /*------------------------------------------------------------------------------------------------------------*/
+void nyx_string_builder_truncate(nyx_string_builder_t *sb, size_t len)
+{
+    if(sb->len > len)
+    {
+        sb->len = len;
     }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    sb->head = NULL;
-    sb->tail = NULL;
-
-    /*----------------------------------------------------------------------------------------------------------------*/
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -83,29 +143,33 @@ void nyx_string_builder_append_buff(nyx_string_builder_t *sb, uint32_t flags, si
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    node_t *node = nyx_memory_alloc(sizeof(node_t) + len + 1);
+    if(flags == NYX_SB_NO_ESCAPE)
+    {
+        _append(sb, len, str);
 
-    memcpy((str_t) (node + 1), str, len);
+        return;
+    }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    node->len = len;
-    node->flags = flags;
-    node->next = NULL;
-
-    /*----------------------------------------------------------------------------------------------------------------*/
+    STR_t p = str;
 
-    if(sb->head == NULL)
+    for(; len > 0; len--, p++)
     {
-        sb->head = node;
-        sb->tail = node;
-    }
-    else
-    {
-        sb->tail->next = node;
-        sb->tail /*-*/ = node;
+        STR_t escaped = _escape(*p, flags);
+
+        if(escaped != NULL)
+        {
+            _append(sb, (size_t) (p - str), str);
+
+            _append(sb, strlen(escaped), escaped);
+
+            str = p + 1;
+        }
     }
 
+    _append(sb, (size_t) (p - str), str);
+
     /*----------------------------------------------------------------------------------------------------------------*/
 }
 
@@ -132,128 +196,7 @@ void nyx_string_builder_append_n(nyx_string_builder_t *sb, uint32_t flags, STR_t
 
 size_t nyx_string_builder_length(const nyx_string_builder_t *sb)
 {
-    size_t result = 0;
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    for(node_t *node = sb->head; node != NULL; node = node->next)
-    {
-        str_t q = (str_t) (node + 1);
-
-        size_t len = node->len;
-
-        if((node->flags & NYX_SB_ESCAPE_JSON) != 0)
-        {
-            if((node->flags & NYX_SB_ESCAPE_XML) != 0)
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(*q++)
-                    {
-                    case '<':
-                    case '>':
-                        result += 4;
-                        break;
-
-                    case '&':
-                        result += 5;
-                        break;
-
-                    case '\"':
-                    case '\'':
-                        result += 6;
-                        break;
-
-                    case '\\':
-                    case '\b':
-                    case '\f':
-                    case '\n':
-                    case '\r':
-                    case '\t':
-                        result += 2;
-                        break;
-
-                    default:
-                        result += 1;
-                        break;
-                    }
-                }
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-            else
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(*q++)
-                    {
-                    case '\"':
-                    case '\\':
-                    case '\b':
-                    case '\f':
-                    case '\n':
-                    case '\r':
-                    case '\t':
-                        result += 2;
-                        break;
-
-                    default:
-                        result += 1;
-                        break;
-                    }
-                }
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-        }
-        else
-        {
-            if((node->flags & NYX_SB_ESCAPE_XML) != 0)
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(*q++)
-                    {
-                    case '<':
-                    case '>':
-                        result += 4;
-                        break;
-
-                    case '&':
-                        result += 5;
-                        break;
-
-                    case '\"':
-                    case '\'':
-                        result += 6;
-                        break;
-
-                    default:
-                        result += 1;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                result += len;
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-        }
-    }
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    return result;
+    return sb->len;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -262,130 +205,14 @@ str_t nyx_string_builder_to_string(const nyx_string_builder_t *sb)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    str_t result = nyx_memory_alloc(nyx_string_builder_length(sb) + 1), /* NOSONAR */ *p = result;
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    char c;
+    str_t result = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_STRING, sb->len + 1);
 
-    for(node_t *node = sb->head; node != NULL; node = node->next)
+    if(sb->len > 0)
     {
-        str_t q = (str_t) (node + 1);
-
-        size_t len = node->len;
-
-        if((node->flags & NYX_SB_ESCAPE_JSON) != 0)
-        {
-            if((node->flags & NYX_SB_ESCAPE_XML) != 0)
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(c = *q++)
-                    {
-                        case '<':
-                            *p++ = '&'; *p++ = 'l'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '>':
-                            *p++ = '&'; *p++ = 'g'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '&':
-                            *p++ = '&'; *p++ = 'a'; *p++ = 'm'; *p++ = 'p'; *p++ = ';'; break;
-
-                        case '\"':
-                            *p++ = '&'; *p++ = 'q'; *p++ = 'u'; *p++ = 'o'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '\'':
-                            *p++ = '&'; *p++ = 'a'; *p++ = 'p'; *p++ = 'o'; *p++ = 's'; *p++ = ';'; break;
-
-                        case '\\': *p++ = '\\'; *p++ = '\\'; break;
-                        case '\b': *p++ = '\\'; *p++ = 'b'; break;
-                        case '\f': *p++ = '\\'; *p++ = 'f'; break;
-                        case '\n': *p++ = '\\'; *p++ = 'n'; break;
-                        case '\r': *p++ = '\\'; *p++ = 'r'; break;
-                        case '\t': *p++ = '\\'; *p++ = 't'; break;
-
-                        default:
-                            *p++ = c;
-                            break;
-                    }
-                }
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-            else
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(c = *q++)
-                    {
-                        case '\"': *p++ = '\\'; *p++ = '\"'; break;
-                        case '\\': *p++ = '\\'; *p++ = '\\'; break;
-                        case '\b': *p++ = '\\'; *p++ = 'b'; break;
-                        case '\f': *p++ = '\\'; *p++ = 'f'; break;
-                        case '\n': *p++ = '\\'; *p++ = 'n'; break;
-                        case '\r': *p++ = '\\'; *p++ = 'r'; break;
-                        case '\t': *p++ = '\\'; *p++ = 't'; break;
-
-                        default:
-                            *p++ = c;
-                            break;
-                    }
-                }
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-        }
-        else
-        {
-            if((node->flags & NYX_SB_ESCAPE_XML) != 0)
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                for(; len > 0; len--)
-                {
-                    switch(c = *q++)
-                    {
-                        case '<':
-                            *p++ = '&'; *p++ = 'l'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '>':
-                            *p++ = '&'; *p++ = 'g'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '&':
-                            *p++ = '&'; *p++ = 'a'; *p++ = 'm'; *p++ = 'p'; *p++ = ';'; break;
-
-                        case '\"':
-                            *p++ = '&'; *p++ = 'q'; *p++ = 'u'; *p++ = 'o'; *p++ = 't'; *p++ = ';'; break;
-
-                        case '\'':
-                            *p++ = '&'; *p++ = 'a'; *p++ = 'p'; *p++ = 'o'; *p++ = 's'; *p++ = ';'; break;
-
-                        default:
-                            *p++ = c;
-                            break;
-                    }
-                }
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-            else
-            {
-                /*----------------------------------------------------------------------------------------------------*/
-
-                p = (str_t) memcpy(p, q, len) + len;
-
-                /*----------------------------------------------------------------------------------------------------*/
-            }
-        }
+        memcpy(result, sb->buff, sb->len);
     }
 
-    /*----------------------------------------------------------------------------------------------------------------*/
-
-    *p = '\0';
+    result[sb->len] = '\0';
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -29,7 +29,7 @@ static nyx_xmldoc_t *transform(const nyx_object_t *dict) // NOLINT(misc-no-recur
     {
         /*------------------------------------------------------------------------------------------------------------*/
 
-        /**/ if(strcmp(key, "<>") == 0)
+        /**/ if(key == NYX_ATOM(TAG))
         {
             str_t value = nyx_object_to_cstring(obj1);
 
@@ -40,7 +40,7 @@ static nyx_xmldoc_t *transform(const nyx_object_t *dict) // NOLINT(misc-no-recur
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        else if(strcmp(key, "$") == 0)
+        else if(key == NYX_ATOM(CONTENT))
         {
             str_t value = nyx_object_to_cstring(obj1);
 
@@ -62,7 +62,7 @@ static nyx_xmldoc_t *transform(const nyx_object_t *dict) // NOLINT(misc-no-recur
 
         /*------------------------------------------------------------------------------------------------------------*/
 
-        else if(strcmp(key, "children") == 0)
+        else if(key == NYX_ATOM(CHILDREN))
         {
             size_t idx;
 
@@ -89,6 +89,120 @@ nyx_xmldoc_t *nyx_object_to_xmldoc(const nyx_object_t *object)
     return object != NULL ? transform(object) : NULL;
 }
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* DIRECT SERIALIZER                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__NYX_INLINE__ void serialize_value(nyx_string_builder_t *sb, uint32_t flags, const nyx_object_t *object)
+{
+    if(object->type == NYX_TYPE_STRING)
+    {
+        STR_t value = ((const nyx_string_t *) object)->value;
+
+        nyx_string_builder_append_buff(sb, flags, strlen(value), value);
+    }
+    else
+    {
+        str_t value = nyx_object_to_cstring(object);
+
+        nyx_string_builder_append_buff(sb, flags, strlen(value), value);
+
+        nyx_memory_free(value);
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void serialize(nyx_string_builder_t *sb, const nyx_object_t *dict) // NOLINT(misc-no-recursion)
+{
+    STR_t key;
+
+    nyx_object_t *obj1;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* OPENING TAG                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t name = nyx_object_to_cstring(nyx_dict_get((const nyx_dict_t *) dict, NYX_ATOM(TAG)));
+
+    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "<", name);
+
+    for(nyx_dict_iter_t iter1 = NYX_DICT_ITER(dict); nyx_dict_iterate(&iter1, &key, &obj1);)
+    {
+        if(key[0] == '@')
+        {
+            nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, " ", key + 1, "=\"");
+            serialize_value(sb, NYX_SB_ESCAPE_XML, obj1);
+            nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "\"");
+        }
+    }
+
+    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, ">");
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* CONTENT                                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t content_start = nyx_string_builder_length(sb);
+
+    for(nyx_dict_iter_t iter1 = NYX_DICT_ITER(dict); nyx_dict_iterate(&iter1, &key, &obj1);)
+    {
+        /**/ if(key == NYX_ATOM(CONTENT))
+        {
+            /* Like nyx_xmldoc_set_content(), the text replaces any previous content. */
+
+            nyx_string_builder_truncate(sb, content_start);
+
+            serialize_value(sb, NYX_SB_ESCAPE_XML, obj1);
+        }
+        else if(key == NYX_ATOM(CHILDREN))
+        {
+            size_t idx;
+
+            nyx_object_t *obj2;
+
+            for(nyx_list_iter_t iter2 = NYX_LIST_ITER(obj1); nyx_list_iterate(&iter2, &idx, &obj2);)
+            {
+                serialize(sb, obj2);
+            }
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* CLOSING TAG                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, "</", name, ">");
+
+    nyx_memory_free(name);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+str_t nyx_object_to_xml_string(const nyx_object_t *object)
+{
+    if(object == NULL)
+    {
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_string_builder_t *sb = nyx_string_builder_new();
+
+    serialize(sb, object);
+
+    str_t result = nyx_string_builder_to_string(sb);
+
+    nyx_string_builder_free(sb);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result;
+}
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 #endif
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -14,6 +14,25 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+STR_t internal_xml_trim(STR_t s, size_t *length)
+{
+    STR_t e = s + *length;
+
+    while(s < e && (isspace((unsigned char) *(s + 0)) || *(s + 0) == '"')) {
+        s++;
+    }
+
+    while(e > s && (isspace((unsigned char) *(e - 1)) || *(e - 1) == '"')) {
+        e--;
+    }
+
+    *length = (size_t) e - (size_t) s;
+
+    return s;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 static nyx_object_t *transform(const nyx_xmldoc_t *curr_node) // NOLINT(misc-no-recursion)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -22,7 +41,7 @@ static nyx_object_t *transform(const nyx_xmldoc_t *curr_node) // NOLINT(misc-no-
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    nyx_dict_set(result, "<>", nyx_string_from(nyx_string_dup(curr_node->name), true));
+    nyx_dict_set_string_unref(result, NYX_ATOM(TAG), nyx_string_dup(curr_node->name), true);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -30,25 +49,13 @@ static nyx_object_t *transform(const nyx_xmldoc_t *curr_node) // NOLINT(misc-no-
     {
         if(new_node->type == NYX_XML_TEXT)
         {
-            STR_t content_s = (STR_t) /* NOSONAR */ new_node->data - 0x0000;
-            size_t length = strlen(content_s);
-            str_t content_e = (str_t) /* NOSONAR */ new_node->data + length;
+            size_t length = strlen(new_node->data);
 
-            while(length > 0 && (isspace((unsigned char) *(content_s + 0)) || *(content_s + 0) == '"')) {
-                content_s++;
-                length--;
-            }
-
-            while(length > 0 && (isspace((unsigned char) *(content_e - 1)) || *(content_e - 1) == '"')) {
-                content_e--;
-                length--;
-            }
+            STR_t content_s = internal_xml_trim(new_node->data, &length);
 
             if(length > 0)
             {
-                *content_e = '\0';
-
-                nyx_dict_set(result, "$", nyx_string_from(nyx_string_dup(content_s), true));
+                nyx_dict_set_string_unref(result, NYX_ATOM(CONTENT), nyx_string_ndup(content_s, length), true);
             }
 
             break;
@@ -64,7 +71,7 @@ static nyx_object_t *transform(const nyx_xmldoc_t *curr_node) // NOLINT(misc-no-
         /**/    str_t attribute_name = nyx_string_builder_to_string(sb);
         /**/
         /**/    /**/
-        /**/    /**/    nyx_dict_set(result, attribute_name, nyx_string_from(nyx_string_dup(attribute->data), true));
+        /**/    /**/    nyx_dict_set_string_unref(result, attribute_name, nyx_string_dup(attribute->data), true);
         /**/    /**/
         /**/
         /**/    nyx_memory_free(attribute_name);
@@ -84,10 +91,16 @@ static nyx_object_t *transform(const nyx_xmldoc_t *curr_node) // NOLINT(misc-no-
             {
                 if(list == NULL)
                 {
-                    nyx_dict_set(result, "children", list = nyx_list_new());
+                    nyx_dict_set(result, NYX_ATOM(CHILDREN), list = nyx_list_new());
+
+                    nyx_object_unref(list);
                 }
 
-                nyx_list_push(list, transform(new_node));
+                nyx_object_t *child = transform(new_node);
+
+                nyx_list_push(list, child);
+
+                nyx_object_unref(child);
             }
         }
     }
@@ -9,6 +9,16 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#if !defined(NYX_BASE64_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define NYX_BASE64_X86
+#  include <immintrin.h>
+#elif !defined(NYX_BASE64_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#  define NYX_BASE64_NEON
+#  include <arm_neon.h>
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 static const /*----*/ char BASE64_ENCODE_TABLE[] = {
     'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
     'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z',
@@ -33,31 +43,428 @@ static const unsigned char BASE64_DECODE_TABLE[] = {
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-str_t nyx_base64_encode(size_t *result_len, size_t size, BUFF_t buff)
+#define DECODE(c) \
+            ((uint32_t) ((unsigned char) (c) < 128 ? BASE64_DECODE_TABLE[(unsigned char) (c)] : 64))
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* X86                                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+#if defined(NYX_BASE64_X86)
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Encoding and decoding follow W. Muła and D. Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions". */
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define SSE_ENCODE_INDICES(in) \
+            _mm_or_si128(                                                                   \
+                _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040)), \
+                _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010))  \
+            )
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__((target("sse4.1"))) static __m128i _sse_encode_lookup(__m128i indices)
 {
-    if(size == 0x00 || buff == NULL)
+    const __m128i shift_lut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A' - 0, 0x000000, 0x000000
+    );
+
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+
+    __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, result), indices);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__((target("sse4.1"))) static size_t _sse_encode(str_t q, const unsigned char *p, size_t size)
+{
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+
+    size_t done = 0;
+
+    /* 16 bytes are loaded but only 12 are consumed per iteration. */
+
+    for(; size - done >= 16; done += 12, q += 16)
     {
-        if(result_len)
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (p + done)), shuffle);
+
+        _mm_storeu_si128((__m128i *) q, _sse_encode_lookup(SSE_ENCODE_INDICES(in)));
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__((target("sse4.1"))) static size_t _sse_decode(unsigned char *q, STR_t p, size_t len)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask_2f = _mm_set1_epi8(0x2F);
+
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t done = 0;
+
+    /* 16 bytes are stored but only 12 are produced per iteration, keep enough input ahead to stay in bounds. */
+
+    for(; len - done >= 24; done += 16, q += 12)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i *) (p + done));
+
+        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2f);
+        __m128i lo_nibbles = _mm_and_si128(/*----------*/(in   ), mask_2f);
+
+        if(!_mm_test_all_zeros(_mm_shuffle_epi8(lut_lo, lo_nibbles), _mm_shuffle_epi8(lut_hi, hi_nibbles)))
         {
-            *result_len = 0x00;
+            break;
         }
 
-        return NULL;
+        __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(in, mask_2f), hi_nibbles));
+
+        in = _mm_add_epi8(in, roll);
+
+        in = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+        in = _mm_madd_epi16(in, _mm_set1_epi32(0x00011000));
+
+        _mm_storeu_si128((__m128i *) q, _mm_shuffle_epi8(in, shuffle));
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__((target("avx2"))) static size_t _avx2_encode(str_t q, const unsigned char *p, size_t size)
+{
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+    );
+
+    const __m256i shift_lut = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A' - 0, 0x000000, 0x000000,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A' - 0, 0x000000, 0x000000
+    );
+
+    size_t done = 0;
+
+    /* Each lane loads 16 bytes (at offsets 0 and 12) but only 24 bytes are consumed per iteration. */
+
+    for(; size - done >= 28; done += 24, q += 32)
+    {
+        __m256i in = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (p + done + 0))),
+            /*------------------*/(_mm_loadu_si128((const __m128i *) (p + done + 12))),
+            1
+        );
+
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        __m256i indices = _mm256_or_si256(
+            _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040)),
+            _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010))
+        );
+
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+
+        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+
+        result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256((__m256i *) q, _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, result), indices));
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+__attribute__((target("avx2"))) static size_t _avx2_decode(unsigned char *q, STR_t p, size_t len)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+    );
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+    );
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+    );
+    const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+
+    const __m256i shuffle = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    );
+
+    const __m256i permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    size_t done = 0;
+
+    /* 32 bytes are stored but only 24 are produced per iteration, keep enough input ahead to stay in bounds. */
+
+    for(; len - done >= 48; done += 32, q += 24)
+    {
+        __m256i in = _mm256_loadu_si256((const __m256i *) (p + done));
+
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+        __m256i lo_nibbles = _mm256_and_si256(/*-------------*/(in   ), mask_2f);
+
+        if(!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles), _mm256_shuffle_epi8(lut_hi, hi_nibbles)))
+        {
+            break;
+        }
+
+        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2f), hi_nibbles));
+
+        in = _mm256_add_epi8(in, roll);
+
+        in = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+        in = _mm256_madd_epi16(in, _mm256_set1_epi32(0x00011000));
+
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        _mm256_storeu_si256((__m256i *) q, _mm256_permutevar8x32_epi32(in, permute));
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* NEON                                                                                                               */
+/*--------------------------------------------------------------------------------------------------------------------*/
+#if defined(NYX_BASE64_NEON)
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _neon_encode(str_t q, const unsigned char *p, size_t size)
+{
+    const uint8x16x4_t table = {{
+        vld1q_u8((const uint8_t *) BASE64_ENCODE_TABLE + 0x00),
+        vld1q_u8((const uint8_t *) BASE64_ENCODE_TABLE + 0x10),
+        vld1q_u8((const uint8_t *) BASE64_ENCODE_TABLE + 0x20),
+        vld1q_u8((const uint8_t *) BASE64_ENCODE_TABLE + 0x30),
+    }};
+
+    const uint8x16_t mask_3f = vdupq_n_u8(0x3F);
+
+    size_t done = 0;
+
+    for(; size - done >= 48; done += 48, q += 64)
+    {
+        uint8x16x3_t in = vld3q_u8(p + done);
+
+        uint8x16x4_t out;
+
+        out.val[0] = vqtbl4q_u8(table, /*------------------------------------------*/ vshrq_n_u8(in.val[0], 2)/*----*/);
+        out.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask_3f));
+        out.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask_3f));
+        out.val[3] = vqtbl4q_u8(table, vandq_u8(/*------------------------------*/ in.val[2] /*------------*/, mask_3f));
+
+        vst4q_u8((uint8_t *) q, out);
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _neon_decode(unsigned char *q, STR_t p, size_t len)
+{
+    const uint8x16x4_t table_lo = {{
+        vld1q_u8(BASE64_DECODE_TABLE + 0x00),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x10),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x20),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x30),
+    }};
+
+    const uint8x16x4_t table_hi = {{
+        vld1q_u8(BASE64_DECODE_TABLE + 0x40),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x50),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x60),
+        vld1q_u8(BASE64_DECODE_TABLE + 0x70),
+    }};
+
+    const uint8x16_t offset = vdupq_n_u8(64);
+
+    size_t done = 0;
+
+    for(; len - done >= 64; done += 64, q += 48)
+    {
+        uint8x16x4_t in = vld4q_u8((const uint8_t *) p + done);
+
+        uint8x16_t invalid = vdupq_n_u8(0);
+
+        for(int i = 0; i < 4; i++)
+        {
+            uint8x16_t c = in.val[i];
+
+            /* Indices 0-63 hit the low table, 64-127 the high one, anything above 127 is rejected. */
+
+            in.val[i] = vqtbx4q_u8(vqtbl4q_u8(table_lo, c), table_hi, vsubq_u8(c, offset));
+
+            invalid = vorrq_u8(invalid, vorrq_u8(vcgeq_u8(in.val[i], offset), vcgeq_u8(c, vdupq_n_u8(128))));
+        }
+
+        if(vmaxvq_u8(invalid) != 0)
+        {
+            break;
+        }
+
+        uint8x16x3_t out;
+
+        out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+        out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+        out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), /*--------*/(in.val[3]   ));
+
+        vst3q_u8(q, out);
+    }
+
+    return done;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* DISPATCH                                                                                                           */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef size_t (* base64_encode_func_t)(str_t q, const unsigned char *p, size_t size);
+
+typedef size_t (* base64_decode_func_t)(unsigned char *q, STR_t p, size_t len);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _none_encode(__NYX_UNUSED__ str_t q, __NYX_UNUSED__ const unsigned char *p, __NYX_UNUSED__ size_t size)
+{
+    return 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t _none_decode(__NYX_UNUSED__ unsigned char *q, __NYX_UNUSED__ STR_t p, __NYX_UNUSED__ size_t len)
+{
+    return 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Written once by nyx_memory_initialize() and only read afterwards, the portable code runs until then. */
+
+static base64_encode_func_t _encode_func = _none_encode;
+
+static base64_decode_func_t _decode_func = _none_decode;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool internal_base64_select(nyx_base64_impl_t impl)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #if defined(NYX_BASE64_X86)
+    __builtin_cpu_init();
+
+    bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+    bool has_sse41 = __builtin_cpu_supports("sse4.1") != 0;
+    #endif
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(impl == NYX_BASE64_IMPL_AUTO)
+    {
+        #if defined(NYX_BASE64_X86)
+        impl = has_avx2 ? NYX_BASE64_IMPL_AVX2 : has_sse41 ? NYX_BASE64_IMPL_SSE41 : NYX_BASE64_IMPL_SCALAR;
+        #elif defined(NYX_BASE64_NEON)
+        impl = NYX_BASE64_IMPL_NEON;
+        #else
+        impl = NYX_BASE64_IMPL_SCALAR;
+        #endif
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    size_t len = 4 * ((size + 2) / 3);
+    switch(impl)
+    {
+        case NYX_BASE64_IMPL_SCALAR:
+            _encode_func = _none_encode;
+            _decode_func = _none_decode;
+            return true;
+
+        #if defined(NYX_BASE64_X86)
+        case NYX_BASE64_IMPL_SSE41:
+            if(has_sse41)
+            {
+                _encode_func = _sse_encode;
+                _decode_func = _sse_decode;
+                return true;
+            }
+            break;
+
+        case NYX_BASE64_IMPL_AVX2:
+            if(has_avx2)
+            {
+                _encode_func = _avx2_encode;
+                _decode_func = _avx2_decode;
+                return true;
+            }
+            break;
+        #endif
+
+        #if defined(NYX_BASE64_NEON)
+        case NYX_BASE64_IMPL_NEON:
+            _encode_func = _neon_encode;
+            _decode_func = _neon_decode;
+            return true;
+        #endif
+
+        default:
+            break;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* BASE64                                                                                                             */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+size_t nyx_base64_encode_to(str_t result_str, size_t size, BUFF_t buff)
+{
+    if(size == 0x00 || buff == NULL)
+    {
+        if(result_str != NULL)
+        {
+            *result_str = '\0';
+        }
 
-    str_t str = nyx_memory_alloc(len + 1);
+        return 0x00;
+    }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    size_t div = size / 3;
-    size_t mod = size % 3;
+    size_t done = _encode_func(result_str, buff, size);
 
-    const unsigned char *p = buff;
-    /*-*/ /*----*/ char *q = str;
+    size_t div = (size - done) / 3;
+    size_t mod = (size - done) % 3;
+
+    const unsigned char *p = (const unsigned char *) buff + done;
+    /*-*/ /*----*/ char *q = result_str + done / 3 * 4;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -112,6 +519,31 @@ str_t nyx_base64_encode(size_t *result_len, size_t size, BUFF_t buff)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    return (size_t) (q - result_str);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+str_t nyx_base64_encode(size_t *result_len, size_t size, BUFF_t buff)
+{
+    if(size == 0x00 || buff == NULL)
+    {
+        if(result_len)
+        {
+            *result_len = 0x00;
+        }
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t str = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BLOB, nyx_base64_encoded_len(size) + 1);
+
+    size_t len = nyx_base64_encode_to(str, size, buff);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
     if(result_len)
     {
         *result_len = len;
@@ -122,16 +554,16 @@ str_t nyx_base64_encode(size_t *result_len, size_t size, BUFF_t buff)
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
+size_t nyx_base64_decode_to(buff_t result_buff, size_t len, STR_t str)
 {
-    if(len == 0x00 || str == NULL)
+    if(len < 0x04 || str == NULL)
     {
-        if(result_size)
+        if(result_buff != NULL)
         {
-            *result_size = 0x00;
+            *(unsigned char *) result_buff = 0x00;
         }
 
-        return NULL;
+        return 0x00;
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
@@ -143,31 +575,27 @@ buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    size_t size = (len / 4) * 3 - pad;
-
-    buff_t buff = nyx_memory_alloc(size + 1);
-
-    /*----------------------------------------------------------------------------------------------------------------*/
-
     size_t blocks = (len / 4) - (
         pad > 0 ? 1 : 0
     );
 
-    const /*----*/ char *p = str;
-    /*-*/ unsigned char *q = buff;
+    size_t done = _decode_func(result_buff, str, 4 * blocks);
+
+    const /*----*/ char *p = str + done;
+    /*-*/ unsigned char *q = (unsigned char *) result_buff + done / 4 * 3;
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    for(size_t i = 0; i < blocks; i++)
+    for(size_t i = done / 4; i < blocks; i++)
     {
         uint32_t triple = (
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[0]] << 18)
+            (DECODE(p[0]) << 18)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[1]] << 12)
+            (DECODE(p[1]) << 12)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[2]] << 6)
+            (DECODE(p[2]) << 6)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[3]] << 0)
+            (DECODE(p[3]) << 0)
         );
 
         *q++ = (triple >> 16) & 0xFF;
@@ -182,11 +610,11 @@ buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
     /**/ if(pad == 1)
     {
         uint32_t triple = (
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[0]] << 18)
+            (DECODE(p[0]) << 18)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[1]] << 12)
+            (DECODE(p[1]) << 12)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[2]] << 6)
+            (DECODE(p[2]) << 6)
         );
 
         *q++ = (triple >> 16) & 0xFF;
@@ -195,9 +623,9 @@ buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
     else if(pad == 2)
     {
         uint32_t triple = (
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[0]] << 18)
+            (DECODE(p[0]) << 18)
             |
-            ((uint32_t) BASE64_DECODE_TABLE[(int) p[1]] << 12)
+            (DECODE(p[1]) << 12)
         );
 
         *q++ = (triple >> 16) & 0xFF;
@@ -209,6 +637,31 @@ buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
+    return (size_t) (q - (unsigned char *) result_buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+buff_t nyx_base64_decode(size_t *result_size, size_t len, STR_t str)
+{
+    if(len < 0x04 || str == NULL)
+    {
+        if(result_size)
+        {
+            *result_size = 0x00;
+        }
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    buff_t buff = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BLOB, nyx_base64_decoded_size(len) + 1);
+
+    size_t size = nyx_base64_decode_to(buff, len, str);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
     if(result_size)
     {
         *result_size = size;
@@ -5,10 +5,10 @@
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+#include <string.h>
+
 #ifdef HAVE_ZLIB
 #  include <zlib.h>
-#else
-#  include <string.h>
 #endif
 
 #include "../nyx_node_internal.h"
@@ -33,7 +33,7 @@ buff_t nyx_zlib_deflate(size_t *result_size, size_t size, BUFF_t buff)
 
     uLongf comp_size = compressBound(size);
 
-    Bytef *comp_buff = nyx_memory_alloc(comp_size);
+    Bytef *comp_buff = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BLOB, comp_size);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -88,7 +88,7 @@ buff_t nyx_zlib_inflate(__NYX_NOTNULL__ size_t *result_size, size_t size, BUFF_t
 
     uLongf uncomp_size = *result_size;
 
-    Bytef *uncomp_buff = nyx_memory_alloc(*result_size);
+    Bytef *uncomp_buff = nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BLOB, *result_size);
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -128,7 +128,7 @@ static const uint32_t ADLER_N_MAX = 5552u;
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-uint32_t internal_adler32(size_t src_size, BUFF_t src_buff)
+uint32_t internal_adler32(uint32_t adler, size_t src_size, BUFF_t src_buff)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
 
@@ -136,8 +136,8 @@ uint32_t internal_adler32(size_t src_size, BUFF_t src_buff)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    uint32_t a = 1u;
-    uint32_t b = 0u;
+    uint32_t a = (adler >> 0) & 0xFFFF;
+    uint32_t b = (adler >> 16) & 0xFFFF;
 
     while(src_size > 0)
     {
@@ -190,7 +190,7 @@ buff_t nyx_zlib_deflate(size_t *result_size, size_t size, BUFF_t buff)
     /*----------------------------------------------------------------------------------------------------------------*/
 
     const uint8_t *src = (const uint8_t *) /*------------*/(  buff  );
-    /*-*/ uint8_t *dst = (/*-*/ uint8_t *) nyx_memory_alloc(dst_size);
+    /*-*/ uint8_t *dst = (/*-*/ uint8_t *) nyx_memory_category_alloc(NYX_MEMORY_CATEGORY_BLOB, dst_size);
 
     uint8_t *result_buff = dst;
 
@@ -232,7 +232,7 @@ buff_t nyx_zlib_deflate(size_t *result_size, size_t size, BUFF_t buff)
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    uint32_t hash = internal_adler32(size, buff);
+    uint32_t hash = internal_adler32(1u, size, buff);
 
     *dst++ = (uint8_t) (hash >> 24);
     *dst++ = (uint8_t) (hash >> 16);
@@ -266,35 +266,614 @@ buff_t nyx_zlib_inflate(__NYX_NOTNULL__ size_t *result_size, __NYX_UNUSED__ size
 /*--------------------------------------------------------------------------------------------------------------------*/
 #endif
 /*--------------------------------------------------------------------------------------------------------------------*/
+/* STREAMING                                                                                                          */
+/*--------------------------------------------------------------------------------------------------------------------*/
 
-str_t nyx_zlib_base64_deflate(size_t *result_len, size_t size, BUFF_t buff)
+#ifndef NYX_ZLIB_CHUNK_SIZE
+#  define NYX_ZLIB_CHUNK_SIZE 16384
+#endif
+
+#if NYX_ZLIB_CHUNK_SIZE < 16 || NYX_ZLIB_CHUNK_SIZE > 65535
+#  error "NYX_ZLIB_CHUNK_SIZE must be in [16, 65535]"
+#endif
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+struct nyx_zlib_stream_s
 {
+    bool base64;
+    bool finished;
+
+    nyx_zlib_sink_t sink;
+    void *ctx;
+
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    size_t comp_size;
-    buff_t comp_buff = nyx_zlib_deflate(&comp_size, size, buff);
+    size_t carry_size;                  /* Bytes (deflate) or characters (inflate) waiting for a complete base64 quantum */
+    char carry[4];
 
-    if(comp_size > 0x00 && comp_buff != NULL)
+    uint8_t chunk[NYX_ZLIB_CHUNK_SIZE]; /* (De)compressed data, or pending stored block without ZLib */
+    char text[4 * (NYX_ZLIB_CHUNK_SIZE / 3) + 8];
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    #ifdef HAVE_ZLIB
+    z_stream z;
+    #else
+    bool header;
+    size_t pending;
+    uint32_t adler;
+    #endif
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_zlib_stream_t *_stream_new(bool base64, nyx_zlib_sink_t sink, void *ctx)
+{
+    nyx_zlib_stream_t *stream = nyx_memory_alloc(sizeof(nyx_zlib_stream_t));
+
+    memset(stream, 0x00, sizeof(nyx_zlib_stream_t));
+
+    stream->base64 = base64;
+    stream->sink = sink;
+    stream->ctx = ctx;
+
+    return stream;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _emit(nyx_zlib_stream_t *stream, size_t size, const uint8_t *buff)
+{
+    if(stream->base64 == false)
     {
-        str_t result_str = nyx_base64_encode(result_len, comp_size, comp_buff);
+        if(size > 0)
+        {
+            stream->sink(stream->ctx, size, buff);
+        }
 
-        nyx_memory_free(comp_buff);
+        return;
+    }
 
-        return result_str;
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(stream->carry_size > 0 && stream->carry_size < 3 && size > 0)
+    {
+        stream->carry[stream->carry_size++] = (char) *buff++;
+
+        size--;
+    }
+
+    if(stream->carry_size == 3)
+    {
+        stream->sink(stream->ctx, nyx_base64_encode_to(stream->text, 3, stream->carry), stream->text);
+
+        stream->carry_size = 0;
     }
 
     /*----------------------------------------------------------------------------------------------------------------*/
 
-    if(result_len != NULL)
+    while(size >= 3)
+    {
+        size_t n = 3 * ((size < NYX_ZLIB_CHUNK_SIZE ? size : NYX_ZLIB_CHUNK_SIZE) / 3);
+
+        stream->sink(stream->ctx, nyx_base64_encode_to(stream->text, n, buff), stream->text);
+
+        buff += n;
+        size -= n;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(; size > 0; size--)
+    {
+        stream->carry[stream->carry_size++] = (char) *buff++;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _emit_end(nyx_zlib_stream_t *stream)
+{
+    if(stream->base64 && stream->carry_size > 0)
+    {
+        stream->sink(stream->ctx, nyx_base64_encode_to(stream->text, stream->carry_size, stream->carry), stream->text);
+
+        stream->carry_size = 0;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _inflate_raw(nyx_zlib_stream_t *stream, size_t size, const uint8_t *buff);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _inflate_text(nyx_zlib_stream_t *stream, size_t len, STR_t str)
+{
+    /* Decoded data go through `text`, which is large enough for one chunk. */
+
+    uint8_t *temp = (uint8_t *) stream->text;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(stream->carry_size > 0 && stream->carry_size < 4 && len > 0)
+    {
+        stream->carry[stream->carry_size++] = *str++;
+
+        len--;
+    }
+
+    if(stream->carry_size == 4)
+    {
+        stream->carry_size = 0;
+
+        if(!_inflate_raw(stream, nyx_base64_decode_to(temp, 4, stream->carry), temp))
+        {
+            return false;
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(len >= 4)
+    {
+        size_t n = 4 * ((len < 4 * (NYX_ZLIB_CHUNK_SIZE / 3) ? len : 4 * (NYX_ZLIB_CHUNK_SIZE / 3)) / 4);
+
+        if(!_inflate_raw(stream, nyx_base64_decode_to(temp, n, str), temp))
+        {
+            return false;
+        }
+
+        str += n;
+        len -= n;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(; len > 0; len--)
+    {
+        stream->carry[stream->carry_size++] = *str++;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#ifdef HAVE_ZLIB
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static int _zlib_strategy(nyx_zlib_strategy_t strategy)
+{
+    switch(strategy)
+    {
+        case NYX_ZLIB_STRATEGY_FILTERED:
+            return Z_FILTERED;
+        case NYX_ZLIB_STRATEGY_HUFFMAN_ONLY:
+            return Z_HUFFMAN_ONLY;
+        case NYX_ZLIB_STRATEGY_RLE:
+            return Z_RLE;
+        case NYX_ZLIB_STRATEGY_FIXED:
+            return Z_FIXED;
+        default:
+            return Z_DEFAULT_STRATEGY;
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _deflate_run(nyx_zlib_stream_t *stream, size_t size, BUFF_t buff, int flush)
+{
+    const uint8_t *p = (const uint8_t *) buff;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    do
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uInt n = size < 0x40000000 ? (uInt) size : 0x40000000;
+
+        stream->z.next_in = (Bytef *) p;
+        stream->z.avail_in = n;
+
+        p += n;
+        size -= n;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        int mode = size > 0 ? Z_NO_FLUSH : flush;
+
+        int ret;
+
+        do
+        {
+            stream->z.next_out = stream->chunk;
+            stream->z.avail_out = NYX_ZLIB_CHUNK_SIZE;
+
+            ret = deflate(&stream->z, mode);
+
+            if(ret == Z_STREAM_ERROR)
+            {
+                NYX_LOG_ERROR("ZLib compression error");
+
+                return false;
+            }
+
+            _emit(stream, NYX_ZLIB_CHUNK_SIZE - stream->z.avail_out, stream->chunk);
+
+        } while(stream->z.avail_out == 0 || (mode == Z_FINISH && ret != Z_STREAM_END));
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+    } while(size > 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_zlib_stream_t *nyx_zlib_deflate_new(int level, nyx_zlib_strategy_t strategy, bool base64, nyx_zlib_sink_t sink, void *ctx)
+{
+    nyx_zlib_stream_t *stream = _stream_new(base64, sink, ctx);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(level < -1 || level > 9)
+    {
+        level = Z_DEFAULT_COMPRESSION;
+    }
+
+    if(deflateInit2(&stream->z, level, Z_DEFLATED, MAX_WBITS, 8, _zlib_strategy(strategy)) != Z_OK)
+    {
+        NYX_LOG_ERROR("Cannot initialize ZLib compression");
+
+        nyx_memory_free(stream);
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return stream;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_deflate_push(nyx_zlib_stream_t *stream, size_t size, BUFF_t buff, bool flush)
+{
+    if(size == 0x00 || buff == NULL)
+    {
+        return flush ? _deflate_run(stream, 0, NULL, Z_SYNC_FLUSH) : true;
+    }
+
+    return _deflate_run(stream, size, buff, flush ? Z_SYNC_FLUSH : Z_NO_FLUSH);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_deflate_end(nyx_zlib_stream_t *stream)
+{
+    bool result = _deflate_run(stream, 0, NULL, Z_FINISH);
+
+    if(result)
+    {
+        _emit_end(stream);
+    }
+
+    deflateEnd(&stream->z);
+
+    nyx_memory_free(stream);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _inflate_raw(nyx_zlib_stream_t *stream, size_t size, const uint8_t *buff)
+{
+    while(size > 0 && stream->finished == false)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        uInt n = size < 0x40000000 ? (uInt) size : 0x40000000;
+
+        stream->z.next_in = (Bytef *) buff;
+        stream->z.avail_in = n;
+
+        buff += n;
+        size -= n;
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        do
+        {
+            stream->z.next_out = stream->chunk;
+            stream->z.avail_out = NYX_ZLIB_CHUNK_SIZE;
+
+            int ret = inflate(&stream->z, Z_NO_FLUSH);
+
+            /**/ if(ret == Z_STREAM_END)
+            {
+                stream->finished = true;
+            }
+            else if(ret != Z_OK && ret != Z_BUF_ERROR)
+            {
+                NYX_LOG_ERROR("ZLib uncompression error: %s", stream->z.msg != NULL ? stream->z.msg : "unknown");
+
+                return false;
+            }
+
+            if(NYX_ZLIB_CHUNK_SIZE > stream->z.avail_out)
+            {
+                stream->sink(stream->ctx, NYX_ZLIB_CHUNK_SIZE - stream->z.avail_out, stream->chunk);
+            }
+
+        } while(stream->finished == false && (stream->z.avail_in > 0 || stream->z.avail_out == 0));
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_zlib_stream_t *nyx_zlib_inflate_new(bool base64, nyx_zlib_sink_t sink, void *ctx)
+{
+    nyx_zlib_stream_t *stream = _stream_new(base64, sink, ctx);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(inflateInit(&stream->z) != Z_OK)
     {
-        *result_len = 0x00;
+        NYX_LOG_ERROR("Cannot initialize ZLib uncompression");
+
+        nyx_memory_free(stream);
+
+        return NULL;
     }
 
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return stream;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_inflate_end(nyx_zlib_stream_t *stream)
+{
+    bool result = stream->finished;
+
+    inflateEnd(&stream->z);
+
+    nyx_memory_free(stream);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#else
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _stored_block(nyx_zlib_stream_t *stream, bool last)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(stream->header == false)
+    {
+        static const uint8_t header[2] = {0x78, 0x01};
+
+        _emit(stream, 2, header);
+
+        stream->header = true;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t chunk = stream->pending;
+
+    uint8_t block[5] = {
+        (uint8_t) last,
+        (uint8_t) (chunk & 0xFF),
+        (uint8_t) (chunk >> 8),
+        (uint8_t) ((~chunk) & 0xFF),
+        (uint8_t) ((~chunk) >> 8),
+    };
+
+    _emit(stream, 5, block);
+
+    _emit(stream, chunk, stream->chunk);
+
+    stream->pending = 0;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_zlib_stream_t *nyx_zlib_deflate_new(__NYX_UNUSED__ int level, __NYX_UNUSED__ nyx_zlib_strategy_t strategy, bool base64, nyx_zlib_sink_t sink, void *ctx)
+{
+    nyx_zlib_stream_t *stream = _stream_new(base64, sink, ctx);
+
+    stream->adler = 1u;
+
+    return stream;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_deflate_push(nyx_zlib_stream_t *stream, size_t size, BUFF_t buff, bool flush)
+{
+    if(size > 0x00 && buff != NULL)
+    {
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        stream->adler = internal_adler32(stream->adler, size, buff);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        const uint8_t *p = (const uint8_t *) buff;
+
+        while(size > 0)
+        {
+            size_t n = NYX_ZLIB_CHUNK_SIZE - stream->pending;
+
+            if(n > size)
+            {
+                n = size;
+            }
+
+            memcpy(stream->chunk + stream->pending, p, n);
+
+            stream->pending += n;
+            p += n;
+            size -= n;
+
+            if(stream->pending == NYX_ZLIB_CHUNK_SIZE)
+            {
+                _stored_block(stream, false);
+            }
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    if(flush && stream->pending > 0)
+    {
+        _stored_block(stream, false);
+    }
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_deflate_end(nyx_zlib_stream_t *stream)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    _stored_block(stream, true);
+
+    uint8_t trailer[4] = {
+        (uint8_t) (stream->adler >> 24),
+        (uint8_t) (stream->adler >> 16),
+        (uint8_t) (stream->adler >> 8),
+        (uint8_t) (stream->adler >> 0),
+    };
+
+    _emit(stream, 4, trailer);
+
+    _emit_end(stream);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_free(stream);
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _inflate_raw(__NYX_UNUSED__ nyx_zlib_stream_t *stream, __NYX_UNUSED__ size_t size, __NYX_UNUSED__ const uint8_t *buff)
+{
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+nyx_zlib_stream_t *nyx_zlib_inflate_new(__NYX_UNUSED__ bool base64, __NYX_UNUSED__ nyx_zlib_sink_t sink, __NYX_UNUSED__ void *ctx)
+{
+    NYX_LOG_ERROR("ZLib uncompression not supported");
+
     return NULL;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+bool nyx_zlib_inflate_end(nyx_zlib_stream_t *stream)
+{
+    nyx_memory_free(stream);
+
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+#endif
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_zlib_inflate_push(nyx_zlib_stream_t *stream, size_t size, BUFF_t buff)
+{
+    if(size == 0x00 || buff == NULL)
+    {
+        return true;
+    }
+
+    return stream->base64 ? _inflate_text(stream, size, (STR_t) buff)
+                          : _inflate_raw(stream, size, (const uint8_t *) buff)
+    ;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* ZLIB + BASE64                                                                                                      */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void _string_builder_sink(void *ctx, size_t size, BUFF_t buff)
+{
+    nyx_string_builder_append_buff((nyx_string_builder_t *) ctx, NYX_SB_NO_ESCAPE, size, (STR_t) buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+str_t nyx_zlib_base64_deflate(size_t *result_len, size_t size, BUFF_t buff)
+{
+    if(size == 0x00 || buff == NULL)
+    {
+        if(result_len != NULL)
+        {
+            *result_len = 0x00;
+        }
+
+        return NULL;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_string_builder_t *sb = nyx_string_builder_new();
+
+    nyx_zlib_stream_t *stream = nyx_zlib_deflate_new(9, NYX_ZLIB_STRATEGY_DEFAULT, true, _string_builder_sink, sb);
+
+    bool success = false;
+
+    if(stream != NULL)
+    {
+        success = nyx_zlib_deflate_push(stream, size, buff, false);
+
+        success = nyx_zlib_deflate_end(stream) && success;
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t result_str = success ? nyx_string_builder_to_string(sb) : NULL;
+
+    if(result_len != NULL)
+    {
+        *result_len = success ? nyx_string_builder_length(sb) : 0x00;
+    }
+
+    nyx_string_builder_free(sb);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result_str;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 buff_t nyx_zlib_base64_inflate(__NYX_NOTNULL__ size_t *result_size, size_t len, STR_t str)
 {
     /*----------------------------------------------------------------------------------------------------------------*/
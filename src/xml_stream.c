@@ -49,26 +49,65 @@ static struct tag_s
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool nyx_xml_stream_detect_opening_tag(nyx_xml_stream_t *xml_stream, size_t size, BUFF_t buff)
+__NYX_INLINE__ bool _is_delimiter(char c)
 {
-    for(size_t i = 0; i < TAG_DEF_NB; i++)
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '/' || c == '>';
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool _find_opening_tag(nyx_xml_stream_t *xml_stream, size_t size, BUFF_t buff)
+{
+    while(xml_stream->scan < size)
     {
-        STR_t p = memmem(buff, size, TAGS[i].s_tag_buff, TAGS[i].s_tag_size);
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        STR_t p = memchr((STR_t) buff + xml_stream->scan, '<', size - xml_stream->scan);
+
+        if(p == NULL)
+        {
+            xml_stream->scan = xml_stream->done = size;
+
+            return false;
+        }
+
+        size_t off = (size_t) (p - (STR_t) buff);
+        size_t rest = size - off;
+
+        /*------------------------------------------------------------------------------------------------------------*/
 
-        if(p != NULL)
+        for(size_t i = 0; i < TAG_DEF_NB; i++)
         {
-            xml_stream->s_ptr = p + 0x000000000000000000000;
+            size_t s_tag_size = TAGS[i].s_tag_size;
 
-            xml_stream->pos = (
-                (size_t) xml_stream->s_ptr
-                -
-                (size_t) /*--*/buff/*--*/
-            );
+            if(rest <= s_tag_size)
+            {
+                if(memcmp(p, TAGS[i].s_tag_buff, rest < s_tag_size ? rest : s_tag_size) == 0)
+                {
+                    /* Possibly truncated opening tag, wait for more data. */
 
-            xml_stream->tag = &TAGS[i];
+                    xml_stream->scan = xml_stream->done = off;
 
-            return true;
+                    return false;
+                }
+            }
+            else if(memcmp(p, TAGS[i].s_tag_buff, s_tag_size) == 0 && _is_delimiter(p[s_tag_size]))
+            {
+                xml_stream->tag = &TAGS[i];
+
+                xml_stream->pos = xml_stream->done = off;
+
+                xml_stream->scan = off + s_tag_size;
+
+                return true;
+            }
         }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        xml_stream->scan = xml_stream->done = off + 1;
+
+        /*------------------------------------------------------------------------------------------------------------*/
     }
 
     return false;
@@ -76,26 +115,67 @@ bool nyx_xml_stream_detect_opening_tag(nyx_xml_stream_t *xml_stream, size_t size
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 
-bool nyx_xml_stream_detect_closing_tag(nyx_xml_stream_t *xml_stream, size_t size, __NYX_UNUSED__ BUFF_t buff)
+static bool _find_closing_tag(nyx_xml_stream_t *xml_stream, size_t size, BUFF_t buff)
 {
-    STR_t p = memmem(xml_stream->s_ptr, size - xml_stream->pos, xml_stream->tag->e_tag_buff, xml_stream->tag->e_tag_size);
+    size_t e_tag_size = xml_stream->tag->e_tag_size;
 
-    if(p != NULL)
+    STR_t p = memmem((STR_t) buff + xml_stream->scan, size - xml_stream->scan, xml_stream->tag->e_tag_buff, e_tag_size);
+
+    if(p == NULL)
     {
-        xml_stream->e_ptr = p + xml_stream->tag->e_tag_size;
+        /* Only the bytes that may start a truncated closing tag need to be scanned again. */
 
-        xml_stream->len = (
-            (size_t) xml_stream->e_ptr
-            -
-            (size_t) xml_stream->s_ptr
-        );
+        if(size - xml_stream->scan >= e_tag_size)
+        {
+            xml_stream->scan = size - (e_tag_size - 1);
+        }
+
+        return false;
+    }
 
-        xml_stream->tag = NULL;
+    size_t end = (size_t) (p - (STR_t) buff) + e_tag_size;
 
-        return true;
+    xml_stream->s_ptr = (STR_t) buff + xml_stream->pos;
+
+    xml_stream->len = end - xml_stream->pos;
+
+    xml_stream->tag = NULL;
+
+    xml_stream->scan = xml_stream->done = end;
+
+    return true;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+bool nyx_xml_stream_next(nyx_xml_stream_t *xml_stream, size_t size, BUFF_t buff)
+{
+    if(xml_stream->tag == NULL && _find_opening_tag(xml_stream, size, buff) == false)
+    {
+        return false;
     }
 
-    return false;
+    return _find_closing_tag(xml_stream, size, buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+size_t nyx_xml_stream_consume(nyx_xml_stream_t *xml_stream)
+{
+    size_t result = xml_stream->done;
+
+    if(xml_stream->tag != NULL)
+    {
+        xml_stream->pos -= result;
+    }
+
+    xml_stream->scan -= result;
+    xml_stream->done = 0;
+
+    xml_stream->s_ptr = NULL;
+    xml_stream->len = 0;
+
+    return result;
 }
 
 /*--------------------------------------------------------------------------------------------------------------------*/
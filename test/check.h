@@ -0,0 +1,41 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef NYX_CHECK_H
+#define NYX_CHECK_H
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+
+#include "../src/nyx_node.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Jumps to the `_err` label of the enclosing function when the condition does not hold. */
+
+#define CHECK(cond) \
+            do { if(!(cond)) { fprintf(stderr, "%s:%d: check `%s` failed\n", __FILE__, __LINE__, #cond); goto _err; } } while(0)
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Ends main(): reports leaked memory, prints the verdict and returns the exit status. */
+
+#define CHECK_EPILOGUE() \
+                CHECK(nyx_memory_finalize());       \
+                                                    \
+                printf("[SUCCESS]\n\n");            \
+                                                    \
+                return 0;                           \
+                                                    \
+            _err:                                   \
+                nyx_memory_finalize();              \
+                                                    \
+                printf("[ERROR]\n\n");              \
+                                                    \
+                return 1
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#endif /* NYX_CHECK_H */
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,230 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/nyx_node.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    size_t allocs;
+    size_t reallocs;
+    size_t frees;
+    size_t usable_size_calls;
+
+} counting_ctx_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Blocks are rounded up like most allocators do and prefixed with their capacity, so that usable_size() can be */
+/* answered without libc help. */
+
+#define PREFIX_SIZE 16
+
+#define CAPACITY(size) \
+            (((size) + 63) & ~(size_t) 63)
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t counting_alloc(void *ctx, size_t size)
+{
+    ((counting_ctx_t *) ctx)->allocs++;
+
+    char *result = malloc(PREFIX_SIZE + CAPACITY(size));
+
+    *(size_t *) result = CAPACITY(size);
+
+    return result + PREFIX_SIZE;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t counting_realloc(void *ctx, buff_t buff, size_t size)
+{
+    ((counting_ctx_t *) ctx)->reallocs++;
+
+    char *result = realloc((char *) buff - PREFIX_SIZE, PREFIX_SIZE + CAPACITY(size));
+
+    *(size_t *) result = CAPACITY(size);
+
+    return result + PREFIX_SIZE;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void counting_free(void *ctx, buff_t buff)
+{
+    ((counting_ctx_t *) ctx)->frees++;
+
+    free((char *) buff - PREFIX_SIZE);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t counting_usable_size(void *ctx, BUFF_t buff)
+{
+    ((counting_ctx_t *) ctx)->usable_size_calls++;
+
+    return *(const size_t *) ((const char *) buff - PREFIX_SIZE);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool exercise(counting_ctx_t *ctx)
+{
+    size_t allocs = ctx->allocs;
+    size_t frees = ctx->frees;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t str = nyx_string_dup("Hello World!");
+
+    bool result = (uintptr_t) str % _Alignof(max_align_t) == 0;
+
+    str = nyx_memory_realloc(str, 1000);
+
+    result = result && (uintptr_t) str % _Alignof(max_align_t) == 0;
+
+    strcat(str, " Hello again!");
+
+    result = result && strcmp(str, "Hello World! Hello again!") == 0;
+
+    nyx_memory_free(str);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *dict = nyx_dict_new();
+
+    nyx_string_t *string = nyx_string_from("bar", false);
+
+    nyx_dict_set(dict, "foo", string);
+
+    nyx_object_unref(string);
+
+    str_t json = nyx_object_to_string(&dict->base);
+
+    result = result && strcmp(json, "{\"foo\":\"bar\"}") == 0;
+
+    nyx_memory_free(json);
+
+    nyx_object_unref(&dict->base);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return result && ctx->allocs > allocs && ctx->frees > frees;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    counting_ctx_t ctx = {0};
+
+    nyx_allocator_t allocator = {
+        .alloc = counting_alloc,
+        .realloc = counting_realloc,
+        .free = counting_free,
+        .usable_size = NULL,
+        .ctx = &ctx,
+    };
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* INVALID ALLOCATOR                                                                                              */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_allocator_t invalid_allocator = {0};
+
+    CHECK(!nyx_memory_set_allocator(&invalid_allocator));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* WITHOUT USABLE_SIZE                                                                                            */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(nyx_memory_set_allocator(&allocator));
+
+    nyx_memory_initialize();
+
+    CHECK(exercise(&ctx));
+
+    CHECK(nyx_memory_finalize());
+
+    CHECK(ctx.usable_size_calls == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* WITH USABLE_SIZE                                                                                               */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    allocator.usable_size = counting_usable_size;
+
+    CHECK(nyx_memory_set_allocator(&allocator));
+
+    nyx_memory_initialize();
+
+    CHECK(exercise(&ctx));
+
+    /* Only queried by realloc. */
+
+    CHECK(ctx.usable_size_calls > 0);
+
+    /* A block with room left is grown without calling realloc(). */
+
+    str_t str = nyx_string_dup("Hello");
+
+    size_t reallocs = ctx.reallocs;
+
+    str = nyx_memory_realloc(str, 24);
+
+    CHECK(ctx.reallocs == reallocs && strcmp(str, "Hello") == 0);
+
+    str = nyx_memory_realloc(str, 4096);
+
+    CHECK(ctx.reallocs == reallocs + 1 && strcmp(str, "Hello") == 0);
+
+    nyx_memory_free(str);
+
+    /* Without accounting (NYX_MEMORY_STATS=0), blocks in use are not tracked. */
+
+    nyx_memory_stats_t stats;
+
+    nyx_memory_stats(&stats);
+
+    bool accounting = stats.total.count > 0;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* MEMORY IN USE                                                                                                  */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    if(accounting)
+    {
+        str = nyx_string_dup("in use");
+
+        CHECK(!nyx_memory_set_allocator(NULL));
+
+        nyx_memory_free(str);
+    }
+
+    CHECK(nyx_memory_finalize());
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* LIBC ALLOCATOR                                                                                                 */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(nyx_memory_set_allocator(NULL));
+
+    size_t allocs = ctx.allocs;
+
+    nyx_memory_initialize();
+
+    nyx_memory_free(nyx_string_dup("libc"));
+
+    CHECK(ctx.allocs == allocs);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,80 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static STR_t JSON = "{\"<>\": \"newNumberVector\", \"@name\": \"numbers\", \"children\": [1, 2, 3]}";
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_FATAL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_arena_t *arena = internal_arena_begin();
+
+    nyx_object_t *root = nyx_object_parse(JSON);
+
+    internal_arena_end(arena, root);
+
+    CHECK(root != NULL && root->type == NYX_TYPE_DICT && root->in_arena);
+
+    nyx_dict_t *dict = (nyx_dict_t *) root;
+
+    nyx_list_t *list = (nyx_list_t *) nyx_dict_get(dict, "children");
+
+    CHECK(list != NULL && list->base.type == NYX_TYPE_LIST && list->base.in_arena);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* READ-ONLY AFTER THE ARENA ENDS                                                                                 */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_number_t *number = nyx_number_from(4.0);
+
+    CHECK(!number->base.in_arena);
+
+    CHECK(!nyx_dict_set(dict, "extra", number));
+    CHECK(!nyx_list_set(list, 3, number));
+    CHECK(!nyx_list_set(list, 0, number));
+
+    CHECK(number->base.parent == NULL && nyx_list_size(list) == 3);
+
+    nyx_object_unref(number);
+
+    /* Managed values are released when rejected. */
+
+    CHECK(!nyx_dict_set_string(dict, "@name", nyx_string_dup("other"), true));
+    CHECK(!nyx_dict_set_string(dict, "@name", "other", false));
+
+    CHECK(strcmp(nyx_dict_get_string(dict, "@name"), "numbers") == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* DELETING AND CLEARING                                                                                          */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_del(dict, "@name");
+
+    CHECK(nyx_dict_get(dict, "@name") == NULL);
+
+    /* The items of an arena list belong to the arena, not to the allocator. */
+
+    nyx_list_clear(list);
+
+    CHECK(nyx_list_size(list) == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_object_unref(root);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
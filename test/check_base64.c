@@ -0,0 +1,265 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static const char TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static const struct
+{
+    nyx_base64_impl_t impl;
+
+    STR_t name;
+
+} IMPLS[] = {
+    {NYX_BASE64_IMPL_SCALAR, "scalar"},
+    {NYX_BASE64_IMPL_SSE41, "SSE4.1"},
+    {NYX_BASE64_IMPL_AVX2, "AVX2"},
+    {NYX_BASE64_IMPL_NEON, "NEON"},
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static uint8_t buff[5000];
+static char expected[8000];
+static char encoded[8000];
+static uint8_t decoded[8000];
+static uint8_t scalar_decoded[8000];
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t reference_encode(char *result, size_t size, const uint8_t *data)
+{
+    size_t j = 0;
+
+    for(size_t i = 0; i < size; i += 3)
+    {
+        uint32_t n = (uint32_t) data[i] << 16;
+
+        if(i + 1 < size) n |= (uint32_t) data[i + 1] << 8;
+        if(i + 2 < size) n |= (uint32_t) data[i + 2] << 0;
+
+        result[j++] = /*----------*/ TABLE[(n >> 18) & 0x3F] /*----------*/;
+        result[j++] = /*----------*/ TABLE[(n >> 12) & 0x3F] /*----------*/;
+        result[j++] = i + 1 < size ? TABLE[(n >> 6) & 0x3F] : '=';
+        result[j++] = i + 2 < size ? TABLE[(n >> 0) & 0x3F] : '=';
+    }
+
+    result[j] = '\0';
+
+    return j;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool check_valid(void)
+{
+    /* Every size up to a few vector widths, then sizes around larger block boundaries. */
+
+    static const size_t SIZES[] = {1000, 1023, 1024, 1025, 3071, 3072, 3073, 4999, 5000};
+
+    for(size_t k = 0; k < 256 + sizeof(SIZES) / sizeof(SIZES[0]); k++)
+    {
+        size_t size = k < 256 ? k : SIZES[k - 256];
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        size_t expected_len = reference_encode(expected, size, buff);
+
+        CHECK(nyx_base64_encoded_len(size) == expected_len);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        size_t encoded_len = nyx_base64_encode_to(encoded, size, buff);
+
+        CHECK(encoded_len == expected_len && memcmp(encoded, expected, expected_len + 1) == 0);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        if(size == 0)
+        {
+            continue;
+        }
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        size_t result_len;
+
+        str_t result_str = nyx_base64_encode(&result_len, size, buff);
+
+        CHECK(result_str != NULL && result_len == expected_len && strcmp(result_str, expected) == 0);
+
+        nyx_memory_free(result_str);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        size_t decoded_size = nyx_base64_decode_to(decoded, expected_len, expected);
+
+        CHECK(decoded_size == size && memcmp(decoded, buff, size) == 0);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        size_t result_size;
+
+        buff_t result_buff = nyx_base64_decode(&result_size, expected_len, expected);
+
+        CHECK(result_buff != NULL && result_size == size && memcmp(result_buff, buff, size) == 0);
+
+        nyx_memory_free(result_buff);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    return true;
+
+_err:
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* A vector implementation stops at the first invalid block, the portable code must then give the same bytes. */
+
+static bool check_invalid(nyx_base64_impl_t impl)
+{
+    static const char INVALID[] = {'!', '-', '_', ' ', '\n', '=', '\0', (char) 0x80, (char) 0xFF};
+
+    static const size_t POSITIONS[] = {0, 1, 5, 17, 31, 47, 63, 64, 100, 250, 395};
+
+    size_t size = 300;
+
+    size_t len = reference_encode(expected, size, buff);
+
+    for(size_t i = 0; i < sizeof(INVALID); i++)
+    {
+        for(size_t j = 0; j < sizeof(POSITIONS) / sizeof(POSITIONS[0]); j++)
+        {
+            size_t pos = POSITIONS[j];
+
+            char saved = expected[pos];
+
+            expected[pos] = INVALID[i];
+
+            /*--------------------------------------------------------------------------------------------------------*/
+
+            CHECK(internal_base64_select(NYX_BASE64_IMPL_SCALAR));
+
+            size_t scalar_size = nyx_base64_decode_to(scalar_decoded, len, expected);
+
+            CHECK(internal_base64_select(impl));
+
+            size_t decoded_size = nyx_base64_decode_to(decoded, len, expected);
+
+            /*--------------------------------------------------------------------------------------------------------*/
+
+            expected[pos] = saved;
+
+            CHECK(decoded_size == scalar_size && memcmp(decoded, scalar_decoded, decoded_size + 1) == 0);
+
+            /* The blocks before the invalid character are decoded normally. */
+
+            CHECK(memcmp(decoded, buff, pos / 4 * 3) == 0);
+        }
+    }
+
+    return true;
+
+_err:
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool check_short(void)
+{
+    static const char *SHORT[] = {"", "Z", "Zg", "Zg="};
+
+    for(size_t i = 0; i < sizeof(SHORT) / sizeof(SHORT[0]); i++)
+    {
+        decoded[0] = 0xAA;
+
+        CHECK(nyx_base64_decode_to(decoded, strlen(SHORT[i]), SHORT[i]) == 0 && decoded[0] == 0x00);
+
+        size_t result_size = 1;
+
+        CHECK(nyx_base64_decode(&result_size, strlen(SHORT[i]), SHORT[i]) == NULL && result_size == 0);
+    }
+
+    CHECK(nyx_base64_decode_to(decoded, 4, NULL) == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Smallest valid inputs. */
+
+    CHECK(nyx_base64_decode_to(decoded, 4, "Zg==") == 1 && memcmp(decoded, "f", 2) == 0);
+    CHECK(nyx_base64_decode_to(decoded, 4, "Zm8=") == 2 && memcmp(decoded, "fo", 3) == 0);
+    CHECK(nyx_base64_decode_to(decoded, 4, "Zm9v") == 3 && memcmp(decoded, "foo", 4) == 0);
+
+    CHECK(nyx_base64_encode_to(encoded, 0, "") == 0 && encoded[0] == '\0');
+    CHECK(nyx_base64_encode_to(encoded, 1, "f") == 4 && strcmp(encoded, "Zg==") == 0);
+
+    return true;
+
+_err:
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    uint32_t seed = 0x12345678;
+
+    for(size_t i = 0; i < sizeof(buff); i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        buff[i] = (uint8_t) (seed >> 16);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* The implementation selected by nyx_memory_initialize(). */
+
+    CHECK(check_valid());
+
+    CHECK(check_short());
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(size_t i = 0; i < sizeof(IMPLS) / sizeof(IMPLS[0]); i++)
+    {
+        if(internal_base64_select(IMPLS[i].impl) == false)
+        {
+            printf("%s: not available, skipped\n", IMPLS[i].name);
+
+            continue;
+        }
+
+        printf("%s\n", IMPLS[i].name);
+
+        CHECK(check_valid());
+
+        CHECK(check_short());
+
+        CHECK(check_invalid(IMPLS[i].impl));
+    }
+
+    CHECK(internal_base64_select(NYX_BASE64_IMPL_AUTO));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,108 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* The cached forms must always be identical to a fresh serialization. */
+
+static bool cache_matches(nyx_dict_t *vector)
+{
+    str_t json = nyx_object_to_string(&vector->base);
+    str_t xml = nyx_object_to_xml_string(&vector->base);
+
+    bool result = strcmp(internal_dict_to_cached_string(vector), json) == 0
+                  &&
+                  strcmp(internal_dict_to_cached_xml_string(vector), xml) == 0
+    ;
+
+    nyx_memory_free(json);
+    nyx_memory_free(xml);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *t1 = nyx_text_prop_new("t1", "Text 1", "foo", false);
+    nyx_dict_t *t2 = nyx_text_prop_new("t2", "Text 2", "bar", false);
+
+    nyx_dict_t *props[] = {t1, t2, NULL};
+
+    nyx_dict_t *vector = nyx_text_vector_new("Device", "Vector", NYX_STATE_IDLE, NYX_PERM_RW, props, NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(cache_matches(vector));
+
+    /* Unchanged vector: the cached bytes are reused. */
+
+    STR_t cached = internal_dict_to_cached_string(vector);
+
+    CHECK(internal_dict_to_cached_string(vector) == cached);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* NYX_DICT_SET ON A CHILD                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_string_t *label = nyx_string_from("New label", false);
+
+    nyx_dict_set(t1, "@label", label);
+
+    nyx_object_unref(label);
+
+    CHECK(vector->cache == NULL);
+
+    CHECK(cache_matches(vector));
+
+    CHECK(strstr(internal_dict_to_cached_string(vector), "New label") != NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* STRING SETTER ON A CHILD                                                                                       */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(nyx_dict_set_string(t2, "$", "baz", false));
+
+    CHECK(vector->cache == NULL);
+
+    CHECK(cache_matches(vector));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* NYX_DICT_DEL ON A CHILD                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_del(t2, "@label");
+
+    CHECK(vector->cache == NULL);
+
+    CHECK(cache_matches(vector));
+
+    CHECK(strstr(internal_dict_to_cached_xml_string(vector), "Text 2") == NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* UNCHANGED VALUE                                                                                                */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    cached = internal_dict_to_cached_string(vector);
+
+    CHECK(!nyx_dict_set_string(t2, "$", "baz", false));
+
+    CHECK(vector->cache != NULL && internal_dict_to_cached_string(vector) == cached);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_object_unref(vector);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
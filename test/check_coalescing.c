@@ -0,0 +1,137 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* A property stays dirty until its vector is actually published. */
+
+#define IS_DIRTY(prop) \
+            (((prop)->base.flags & NYX_FLAGS_DIRTY) != 0)
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static size_t nb_pending(const nyx_node_t *node)
+{
+    size_t result = 0;
+
+    for(nyx_dict_t **pending_ptr = node->pending_vectors; *pending_ptr != NULL; pending_ptr++)
+    {
+        result++;
+    }
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_ERROR);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *n1 = nyx_number_prop_new_double("n1", "N1", "%.1f", 0.0, 100.0, 1.0, 5.0);
+    nyx_dict_t *n2 = nyx_number_prop_new_double("n2", "N2", "%.1f", 0.0, 100.0, 1.0, 7.0);
+
+    nyx_dict_t *number_props[] = {n1, n2, NULL};
+
+    nyx_dict_t *number_vector = nyx_number_vector_new("Dev", "numbers", NYX_STATE_OK, NYX_PERM_RW, number_props, NULL);
+
+    nyx_dict_t *l1 = nyx_light_prop_new("l1", "L1", NYX_STATE_IDLE);
+
+    nyx_dict_t *light_props[] = {l1, NULL};
+
+    nyx_dict_t *light_vector = nyx_light_vector_new("Dev", "lights", NYX_STATE_OK, light_props, NULL);
+
+    nyx_dict_t *vectors[] = {number_vector, light_vector, NULL};
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_t *node = nyx_node_initialize("node", vectors, NULL, NULL, NULL, NULL, NULL, NULL, 1000, true);
+
+    CHECK(node != NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* IMMEDIATE                                                                                                      */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_number_prop_set_double(n1, 10.0);
+
+    CHECK(nyx_object_notify(&n1->base));
+
+    CHECK(!IS_DIRTY(n1) && nb_pending(node) == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* COALESCED                                                                                                      */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_set_notify_coalescing(node, true, false);
+
+    nyx_number_prop_set_double(n1, 11.0);
+    CHECK(nyx_object_notify(&n1->base));
+
+    nyx_number_prop_set_double(n2, 12.0);
+    CHECK(nyx_object_notify(&n2->base));
+
+    nyx_number_prop_set_double(n1, 13.0);
+    CHECK(nyx_object_notify(&n1->base));
+
+    nyx_light_prop_set(l1, NYX_STATE_BUSY);
+    CHECK(nyx_object_notify(&l1->base));
+
+    /* Queued once per vector, nothing published yet. */
+
+    CHECK(nb_pending(node) == 2);
+    CHECK(node->pending_vectors[0] == number_vector && node->pending_vectors[1] == light_vector);
+    CHECK(IS_DIRTY(n1) && IS_DIRTY(n2) && IS_DIRTY(l1));
+
+    nyx_node_poll(node, 0);
+
+    CHECK(nb_pending(node) == 0);
+    CHECK(!IS_DIRTY(n1) && !IS_DIRTY(n2) && !IS_DIRTY(l1));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* PACKED                                                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_set_notify_coalescing(node, true, true);
+
+    nyx_number_prop_set_double(n2, 14.0);
+    CHECK(nyx_object_notify(&n2->base));
+
+    nyx_light_prop_set(l1, NYX_STATE_ALERT);
+    CHECK(nyx_object_notify(&l1->base));
+
+    CHECK(nb_pending(node) == 2 && IS_DIRTY(n2) && IS_DIRTY(l1));
+
+    nyx_node_poll(node, 0);
+
+    CHECK(nb_pending(node) == 0 && !IS_DIRTY(n2) && !IS_DIRTY(l1));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* DISABLING COALESCING FLUSHES THE QUEUE                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_number_prop_set_double(n1, 15.0);
+    CHECK(nyx_object_notify(&n1->base));
+
+    CHECK(nb_pending(node) == 1 && IS_DIRTY(n1));
+
+    nyx_node_set_notify_coalescing(node, false, false);
+
+    CHECK(nb_pending(node) == 0 && !IS_DIRTY(n1));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_finalize(node, true);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,150 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Compares two objects both ways, then releases them. */
+
+static bool equal(void *object1, void *object2)
+{
+    bool result1 = nyx_object_equal(object1, object2);
+    bool result2 = nyx_object_equal(object2, object1);
+
+    nyx_object_unref(object2);
+    nyx_object_unref(object1);
+
+    if(result1 != result2)
+    {
+        fprintf(stderr, "nyx_object_equal() is not symmetric\n");
+    }
+
+    return result1 && result2;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool parsed_equal(STR_t json1, STR_t json2)
+{
+    return equal(nyx_object_parse(json1), nyx_object_parse(json2));
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static nyx_dict_t *dict_of(STR_t key, void *value)
+{
+    nyx_dict_t *result = nyx_dict_new();
+
+    nyx_dict_set(result, key, value);
+
+    nyx_object_unref(value);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_ERROR);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* NUMBERS                                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(equal(nyx_number_from(1.5), nyx_number_from(1.5)));
+    CHECK(equal(nyx_number_from(0.0), nyx_number_from(-0.0)));
+    CHECK(equal(nyx_number_from(NAN), nyx_number_from(NAN)));
+    CHECK(equal(nyx_number_from(-NAN), nyx_number_from(NAN)));
+
+    CHECK(!equal(nyx_number_from(NAN), nyx_number_from(0.0)));
+    CHECK(!equal(nyx_number_from(INFINITY), nyx_number_from(-INFINITY)));
+    CHECK(!equal(nyx_number_from(1.0), nyx_string_from("1", false)));
+
+    /* A NaN property value must not be seen as modified when set again. */
+
+    CHECK(equal(dict_of("n", nyx_number_from(NAN)), dict_of("n", nyx_number_from(NAN))));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* STRINGS                                                                                                        */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(equal(nyx_string_from("foo", false), nyx_string_from(nyx_string_dup("foo"), true)));
+
+    CHECK(equal(nyx_string_from_buff(3, "a\0b", false), nyx_string_from_buff(3, "a\0b", false)));
+
+    /* Bytes after an embedded NUL are compared, and so is the length. */
+
+    CHECK(!equal(nyx_string_from_buff(3, "a\0b", false), nyx_string_from_buff(3, "a\0c", false)));
+    CHECK(!equal(nyx_string_from_buff(3, "a\0b", false), nyx_string_from_buff(2, "a\0b", false)));
+    CHECK(!equal(nyx_string_from_buff(3, "a\0b", false), nyx_string_from("a", false)));
+    CHECK(!equal(nyx_string_from_buff(1, "\0", false), nyx_string_from("", false)));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* LISTS                                                                                                          */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(parsed_equal("[]", "[]"));
+    CHECK(parsed_equal("[1, \"a\", [true, null], {\"b\": 2}]", "[1, \"a\", [true, null], {\"b\": 2}]"));
+
+    CHECK(!parsed_equal("[1, 2]", "[2, 1]"));
+    CHECK(!parsed_equal("[1, 2]", "[1, 2, 3]"));
+    CHECK(!parsed_equal("[[1, 2]]", "[[1, 3]]"));
+    CHECK(!parsed_equal("[]", "{}"));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* DICTS                                                                                                          */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(parsed_equal("{}", "{}"));
+    CHECK(parsed_equal("{\"a\": 1, \"b\": {\"c\": [1, 2]}}", "{\"a\": 1, \"b\": {\"c\": [1, 2]}}"));
+
+    /* Entries are compared in order. */
+
+    CHECK(!parsed_equal("{\"a\": 1, \"b\": 2}", "{\"b\": 2, \"a\": 1}"));
+    CHECK(!parsed_equal("{\"<>\": \"foo\", \"@name\": \"bar\"}", "{\"@name\": \"bar\", \"<>\": \"foo\"}"));
+
+    /* Sizes differ while the common entries match, in both orders. */
+
+    CHECK(!parsed_equal("{\"a\": 1}", "{\"a\": 1, \"b\": 2}"));
+    CHECK(!parsed_equal("{}", "{\"a\": 1}"));
+    CHECK(!parsed_equal("{\"b\": {\"a\": 1}}", "{\"b\": {\"a\": 1, \"c\": 3}}"));
+
+    /* Same size, same values, different keys or values. */
+
+    CHECK(!parsed_equal("{\"a\": 1}", "{\"b\": 1}"));
+    CHECK(!parsed_equal("{\"a\": 1}", "{\"a\": \"1\"}"));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* ATOM AND NON-ATOM KEYS                                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Vocabulary keys are atoms whatever the way they are provided. */
+
+    CHECK(equal(dict_of(NYX_ATOM(NAME), nyx_number_from(1.0)), dict_of("@name", nyx_number_from(1.0))));
+
+    /* Other keys are stored by copy and compared by content. */
+
+    char key1[] = "@foo";
+    char key2[] = "@foo";
+
+    CHECK(equal(dict_of(key1, nyx_number_from(1.0)), dict_of(key2, nyx_number_from(1.0))));
+
+    /* An atom never equals a non-atom key. */
+
+    CHECK(!equal(dict_of(NYX_ATOM(NAME), nyx_number_from(1.0)), dict_of("@names", nyx_number_from(1.0))));
+    CHECK(!equal(dict_of(NYX_ATOM(NAME), nyx_number_from(1.0)), dict_of("@nam", nyx_number_from(1.0))));
+    CHECK(!equal(dict_of(NYX_ATOM(NAME), nyx_number_from(1.0)), dict_of("@device", nyx_number_from(1.0))));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,164 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/nyx_node.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define CATEGORY(stats, category) \
+            ((stats).categories[(category) - NYX_MEMORY_CATEGORY_OTHER])
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t header_alloc(__NYX_UNUSED__ void *ctx, size_t size)
+{
+    return malloc(size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static buff_t header_realloc(__NYX_UNUSED__ void *ctx, buff_t buff, size_t size)
+{
+    return realloc(buff, size);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void header_free(__NYX_UNUSED__ void *ctx, buff_t buff)
+{
+    free(buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool all_zero(const nyx_memory_stats_t *stats)
+{
+    for(size_t i = 0; i < NYX_MEMORY_CATEGORY_NB; i++)
+    {
+        if(stats->categories[i].current != 0)
+        {
+            return false;
+        }
+    }
+
+    return stats->total.current == 0;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool exercise(void)
+{
+    nyx_memory_stats_t stats;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_initialize();
+
+    nyx_memory_stats(&stats);
+
+    CHECK(all_zero(&stats) && stats.total.count == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *dict = nyx_dict_new();
+
+    for(int i = 0; i < 100; i++)
+    {
+        char key[16];
+
+        snprintf(key, sizeof(key), "key%d", i);
+
+        nyx_string_t *string = nyx_string_from(nyx_string_dup("a managed string value"), true);
+
+        nyx_dict_set(dict, key, string);
+
+        nyx_object_unref(string);
+    }
+
+    str_t json = nyx_object_to_string(&dict->base);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_stats(&stats);
+
+    CHECK(CATEGORY(stats, NYX_MEMORY_CATEGORY_OBJECT).current > 0);
+    CHECK(CATEGORY(stats, NYX_MEMORY_CATEGORY_STRING).current > 0);
+    CHECK(CATEGORY(stats, NYX_MEMORY_CATEGORY_STRING).count >= 100);
+    CHECK(stats.total.current > 0 && stats.total.peak >= stats.total.current);
+
+    size_t peak = stats.total.peak;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* A reallocated block keeps its category. */
+
+    str_t str = nyx_memory_alloc(16);
+
+    CHECK((uintptr_t) str % _Alignof(max_align_t) == 0);
+
+    str = nyx_memory_realloc(str, 4096);
+
+    CHECK((uintptr_t) str % _Alignof(max_align_t) == 0);
+
+    nyx_memory_stats(&stats);
+
+    CHECK(CATEGORY(stats, NYX_MEMORY_CATEGORY_OTHER).current >= 4096);
+
+    nyx_memory_free(str);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_free(json);
+
+    nyx_object_unref(&dict->base);
+
+    nyx_memory_stats(&stats);
+
+    CHECK(all_zero(&stats) && stats.total.peak >= peak);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    return nyx_memory_finalize();
+
+_err:
+    return false;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* DEFAULT ALLOCATOR                                                                                              */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(exercise());
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* ALLOCATOR WITHOUT USABLE_SIZE                                                                                  */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_allocator_t allocator = {
+        .alloc = header_alloc,
+        .realloc = header_realloc,
+        .free = header_free,
+        .usable_size = NULL,
+        .ctx = NULL,
+    };
+
+    CHECK(nyx_memory_set_allocator(&allocator));
+
+    CHECK(exercise());
+
+    CHECK(nyx_memory_set_allocator(NULL));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,174 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Publishing clears the dirty flag of the properties, a held back notification leaves it set. */
+
+#define IS_DIRTY(prop) \
+            (((prop)->base.flags & NYX_FLAGS_DIRTY) != 0)
+
+#define RATE_LIMIT(node, vector) \
+            ((node)->rate_limits[(vector)->node_idx - 1])
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static double value = 0.0;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool update(nyx_dict_t *prop)
+{
+    nyx_number_prop_set_double(prop, value += 1.0);
+
+    nyx_object_notify(&prop->base);
+
+    return !IS_DIRTY(prop);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void poll_for(const nyx_node_t *node, uint32_t duration_ms)
+{
+    uint64_t start_ms = internal_get_millis();
+
+    while(internal_get_millis() - start_ms < duration_ms)
+    {
+        nyx_node_poll(node, 0);
+    }
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_ERROR);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *n1 = nyx_number_prop_new_double("n1", "N1", "%.1f", 0.0, 1.0e9, 1.0, 0.0);
+
+    nyx_dict_t *props[] = {n1, NULL};
+
+    nyx_dict_t *vector = nyx_number_vector_new("Dev", "numbers", NYX_STATE_OK, NYX_PERM_RO, props, NULL);
+
+    nyx_dict_t *vectors[] = {vector, NULL};
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_t *node = nyx_node_initialize("node", vectors, NULL, NULL, NULL, NULL, NULL, NULL, 1000, true);
+
+    CHECK(node != NULL && vector->node_idx == 1);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* WINDOW                                                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    static const struct { double max_rate; uint32_t interval_ms; } WINDOWS[] = {
+        {0.0, 0},
+        {-1.0, 0},
+        {1.0, 1000},
+        {3.0, 334},
+        {0.5, 2000},
+        {999.0, 2},
+        {1000.0, 1},
+        {5000.0, 1},
+        {1.0e9, 1},
+        {1.0e-12, UINT32_MAX},
+    };
+
+    for(size_t i = 0; i < sizeof(WINDOWS) / sizeof(WINDOWS[0]); i++)
+    {
+        nyx_node_set_publish_rate(node, "Dev", "numbers", WINDOWS[i].max_rate);
+
+        CHECK(RATE_LIMIT(node, vector).interval_ms == WINDOWS[i].interval_ms);
+
+        nyx_node_set_publish_rate(node, "Dev", NULL, 0.0);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* HELD BACK, THEN PUBLISHED BY THE TIMER                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_set_publish_rate(node, "Dev", "numbers", 10.0);
+
+    CHECK(update(n1));
+    CHECK(!update(n1));
+    CHECK(!update(n1));
+
+    CHECK(RATE_LIMIT(node, vector).pending);
+
+    poll_for(node, 150);
+
+    CHECK(!IS_DIRTY(n1) && !RATE_LIMIT(node, vector).pending);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* REMOVING THE LIMIT PUBLISHES WHAT IS HELD BACK                                                                 */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(!update(n1));
+
+    nyx_node_set_publish_rate(node, "Dev", "numbers", 0.0);
+
+    CHECK(!IS_DIRTY(n1) && !RATE_LIMIT(node, vector).pending);
+
+    CHECK(update(n1));
+    CHECK(update(n1));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* ABOVE 1 KHZ                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Without the millisecond clamp, a 5 kHz limit used to yield a zero window and let every notification through. */
+
+    nyx_node_set_publish_rate(node, "Dev", "numbers", 5000.0);
+
+    size_t nb_published = 0;
+
+    uint64_t start_ms = internal_get_millis();
+
+    for(int i = 0; i < 100000; i++)
+    {
+        nb_published += update(n1);
+    }
+
+    uint64_t elapsed_ms = internal_get_millis() - start_ms;
+
+    CHECK(nb_published >= 1 && nb_published <= elapsed_ms + 1);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* WRAP-AROUND                                                                                                    */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Stamps are 32-bit like Arduino's millis() and compared modulo 2^32. */
+
+    nyx_node_set_publish_rate(node, "Dev", "numbers", 0.0);
+
+    nyx_node_set_publish_rate(node, "Dev", "numbers", 1.0);
+
+    uint32_t now = (uint32_t) internal_get_millis();
+
+    RATE_LIMIT(node, vector).last_ms = now - 10U;
+
+    CHECK(!update(n1));
+
+    RATE_LIMIT(node, vector).last_ms = now - 2000U;
+
+    RATE_LIMIT(node, vector).pending = false;
+
+    CHECK(update(n1));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_finalize(node, true);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,180 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Returns the `name=content` pairs of the oneXXX entries, e.g. `s1="Off",s2="On",`, or NULL if malformed. */
+
+static str_t children_of(nyx_dict_t *set_vector, STR_t one_tag)
+{
+    nyx_string_builder_t *sb = nyx_string_builder_new();
+
+    nyx_object_t *list = nyx_dict_get(set_vector, NYX_ATOM(CHILDREN));
+
+    bool ok = list != NULL && list->type == NYX_TYPE_LIST;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t idx;
+
+    nyx_object_t *object;
+
+    for(nyx_list_iter_t iter = NYX_LIST_ITER(list); ok && nyx_list_iterate(&iter, &idx, &object);)
+    {
+        ok = object->type == NYX_TYPE_DICT;
+
+        if(ok)
+        {
+            STR_t tag = nyx_dict_get_string((nyx_dict_t *) object, NYX_ATOM(TAG));
+            STR_t name = nyx_dict_get_string((nyx_dict_t *) object, NYX_ATOM(NAME));
+
+            str_t content = nyx_object_to_string(nyx_dict_get((nyx_dict_t *) object, NYX_ATOM(CONTENT)));
+
+            ok = tag != NULL && strcmp(tag, one_tag) == 0 && name != NULL && content != NULL;
+
+            if(ok)
+            {
+                nyx_string_builder_append(sb, NYX_SB_NO_ESCAPE, name, "=", content, ",");
+            }
+
+            nyx_memory_free(content);
+        }
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    str_t result = ok ? nyx_string_builder_to_string(sb) : NULL;
+
+    nyx_string_builder_free(sb);
+
+    nyx_object_unref(&set_vector->base);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool same_children(nyx_dict_t *set_vector, STR_t one_tag, STR_t expected)
+{
+    str_t children = children_of(set_vector, one_tag);
+
+    bool result = children != NULL && strcmp(children, expected) == 0;
+
+    if(result == false)
+    {
+        fprintf(stderr, "got: %s\nexpected: %s\n", children != NULL ? children : "(null)", expected);
+    }
+
+    nyx_memory_free(children);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_ERROR);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_dict_t *n1 = nyx_number_prop_new_int("n1", "N1", "%d", 0, 100, 1, 5);
+    nyx_dict_t *n2 = nyx_number_prop_new_int("n2", "N2", "%d", 0, 100, 1, 7);
+    nyx_dict_t *n3 = nyx_number_prop_new_int("n3", "N3", "%d", 0, 100, 1, 9);
+
+    nyx_dict_t *number_props[] = {n1, n2, n3, NULL};
+
+    nyx_dict_t *number_vector = nyx_number_vector_new("Dev", "numbers", NYX_STATE_OK, NYX_PERM_RW, number_props, NULL);
+
+    /**/
+
+    nyx_dict_t *one_of_many[] = {nyx_switch_prop_new("s1", "S1", NYX_ONOFF_ON), nyx_switch_prop_new("s2", "S2", NYX_ONOFF_OFF), NULL};
+    nyx_dict_t *at_most_one[] = {nyx_switch_prop_new("s1", "S1", NYX_ONOFF_OFF), nyx_switch_prop_new("s2", "S2", NYX_ONOFF_OFF), NULL};
+    nyx_dict_t *any_of_many[] = {nyx_switch_prop_new("s1", "S1", NYX_ONOFF_ON), nyx_switch_prop_new("s2", "S2", NYX_ONOFF_OFF), NULL};
+
+    nyx_dict_t *one_of_many_vector = nyx_switch_vector_new("Dev", "one_of_many", NYX_STATE_OK, NYX_PERM_RW, NYX_RULE_ONE_OF_MANY, one_of_many, NULL);
+    nyx_dict_t *at_most_one_vector = nyx_switch_vector_new("Dev", "at_most_one", NYX_STATE_OK, NYX_PERM_RW, NYX_RULE_AT_MOST_ONE, at_most_one, NULL);
+    nyx_dict_t *any_of_many_vector = nyx_switch_vector_new("Dev", "any_of_many", NYX_STATE_OK, NYX_PERM_RW, NYX_RULE_ANY_OF_MANY, any_of_many, NULL);
+
+    /**/
+
+    nyx_dict_t *vectors[] = {number_vector, one_of_many_vector, at_most_one_vector, any_of_many_vector, NULL};
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_t *node = nyx_node_initialize("node", vectors, NULL, NULL, NULL, NULL, NULL, NULL, 1000, true);
+
+    CHECK(node != NULL);
+
+    /* Start from published vectors. */
+
+    for(size_t i = 0; vectors[i] != NULL; i++)
+    {
+        CHECK(nyx_object_notify(&vectors[i]->base));
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* DELTA                                                                                                          */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(same_children(nyx_number_set_vector_new(number_vector), "oneNumber", ""));
+
+    nyx_number_prop_set_int(n2, 42);
+    nyx_number_prop_set_int(n3, 43);
+
+    CHECK(same_children(nyx_number_set_vector_new(number_vector), "oneNumber", "n2=\"42\",n3=\"43\","));
+
+    /* Building a set vector has no side effect, the properties stay modified until published. */
+
+    CHECK(same_children(nyx_number_set_vector_new(number_vector), "oneNumber", "n2=\"42\",n3=\"43\","));
+
+    CHECK(nyx_object_notify(&n2->base));
+
+    CHECK(same_children(nyx_number_set_vector_new(number_vector), "oneNumber", ""));
+
+    /* Setting the same value again is not a modification. */
+
+    nyx_number_prop_set_int(n1, 5);
+    nyx_number_prop_set_int(n3, 44);
+
+    CHECK(same_children(nyx_number_set_vector_new(number_vector), "oneNumber", "n3=\"44\","));
+
+    CHECK(nyx_object_notify(&n3->base));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* SWITCHES                                                                                                       */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* OneOfMany and AtMostOne vectors are always sent in full, AnyOfMany ones as a delta. */
+
+    CHECK(same_children(nyx_switch_set_vector_new(one_of_many_vector), "oneSwitch", "s1=\"On\",s2=\"Off\","));
+    CHECK(same_children(nyx_switch_set_vector_new(at_most_one_vector), "oneSwitch", "s1=\"Off\",s2=\"Off\","));
+    CHECK(same_children(nyx_switch_set_vector_new(any_of_many_vector), "oneSwitch", ""));
+
+    nyx_switch_prop_set(one_of_many[0], NYX_ONOFF_OFF);
+    nyx_switch_prop_set(one_of_many[1], NYX_ONOFF_ON);
+    nyx_switch_prop_set(at_most_one[1], NYX_ONOFF_ON);
+    nyx_switch_prop_set(any_of_many[1], NYX_ONOFF_ON);
+
+    CHECK(same_children(nyx_switch_set_vector_new(one_of_many_vector), "oneSwitch", "s1=\"Off\",s2=\"On\","));
+    CHECK(same_children(nyx_switch_set_vector_new(at_most_one_vector), "oneSwitch", "s1=\"Off\",s2=\"On\","));
+    CHECK(same_children(nyx_switch_set_vector_new(any_of_many_vector), "oneSwitch", "s2=\"On\","));
+
+    CHECK(nyx_object_notify(&any_of_many_vector->base));
+
+    CHECK(same_children(nyx_switch_set_vector_new(any_of_many_vector), "oneSwitch", ""));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_finalize(node, true);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
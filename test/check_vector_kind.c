@@ -0,0 +1,109 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Vectors built by hand or parsed from JSON carry their "<>" tag but no kind until attached to a node. */
+
+static nyx_dict_t *vector_new(STR_t tag, STR_t name)
+{
+    nyx_dict_t *result = nyx_dict_new();
+
+    if(tag != NULL)
+    {
+        nyx_dict_set_string_unref(result, "<>", tag, false);
+    }
+
+    nyx_dict_set_string_unref(result, "@client", "", false);
+    nyx_dict_set_string_unref(result, "@device", "Dev", false);
+    nyx_dict_set_string_unref(result, "@name", nyx_string_dup(name), true);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_ERROR);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    static const struct { STR_t tag; nyx_vector_kind_t kind; } KINDS[] = {
+        {"defNumberVector", NYX_VECTOR_KIND_NUMBER},
+        {"defTextVector", NYX_VECTOR_KIND_TEXT},
+        {"defLightVector", NYX_VECTOR_KIND_LIGHT},
+        {"defSwitchVector", NYX_VECTOR_KIND_SWITCH},
+        {"defBLOBVector", NYX_VECTOR_KIND_BLOB},
+        {"defStreamVector", NYX_VECTOR_KIND_STREAM},
+        {"setNumberVector", NYX_VECTOR_KIND_NONE},
+        {"defNumber", NYX_VECTOR_KIND_NONE},
+        {NULL, NYX_VECTOR_KIND_NONE},
+    };
+
+    #define NB_KINDS (sizeof(KINDS) / sizeof(KINDS[0]))
+
+    nyx_dict_t *vectors[NB_KINDS + 3];
+
+    for(size_t i = 0; i < NB_KINDS; i++)
+    {
+        char name[16];
+
+        snprintf(name, sizeof(name), "vector%zu", i);
+
+        vectors[i] = vector_new(KINDS[i].tag, name);
+
+        CHECK(vectors[i]->kind == NYX_VECTOR_KIND_NONE);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Parsed from JSON. */
+
+    nyx_object_t *parsed = nyx_object_parse("{\"<>\": \"defSwitchVector\", \"@client\": \"none\", \"@device\": \"Dev\", \"@name\": \"parsed\"}");
+
+    CHECK(parsed != NULL && parsed->type == NYX_TYPE_DICT);
+
+    vectors[NB_KINDS + 0] = (nyx_dict_t *) parsed;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* An explicit kind is kept whatever the tag says. */
+
+    nyx_dict_t *explicit_vector = vector_new("defTextVector", "explicit");
+
+    explicit_vector->kind = NYX_VECTOR_KIND_LIGHT;
+
+    vectors[NB_KINDS + 1] = explicit_vector;
+
+    vectors[NB_KINDS + 2] = NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_t *node = nyx_node_initialize("node", vectors, NULL, NULL, NULL, NULL, NULL, NULL, 1000, true);
+
+    CHECK(node != NULL);
+
+    for(size_t i = 0; i < NB_KINDS; i++)
+    {
+        CHECK(vectors[i]->kind == KINDS[i].kind);
+    }
+
+    CHECK(vectors[NB_KINDS + 0]->kind == NYX_VECTOR_KIND_SWITCH);
+
+    CHECK(explicit_vector->kind == NYX_VECTOR_KIND_LIGHT);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_node_finalize(node, true);
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,226 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* nyx_xml_buff_to_object() must accept and reject exactly what nyx_xmldoc_parse_buff() + nyx_xmldoc_to_object() do, */
+/* and build the same objects with the same key order. */
+
+static STR_t FIXTURES[] = {
+    /* test/valid_xml.sh */
+    "<foo></foo>",
+    "<foo:bar></foo:bar>",
+    "<foo bar=\"baz\"></foo>",
+    "<foo bar=\"baz\" qux=\"quux\"></foo>",
+    "<foo />",
+    "<foo>bar</foo>",
+    "<foo><bar>baz</bar></foo>",
+    "<foo><bar /></foo>",
+    "<foo><bar baz=\"qux\">foobar</bar></foo>",
+    "<foo>   <bar>baz</bar>   </foo>",
+    "<foo>&lt;bar&gt;</foo>",
+    "<foo><![CDATA[<bar>baz</bar>]]></foo>",
+    "<foo bar=\"baz &amp; qux\"></foo>",
+    "<foo><!-- comment --></foo>",
+    /* INDI */
+    "<getProperties version=\"1.7\" />",
+    "<getProperties version='1.7' device=\"Dev\" name=\"numbers\"/>",
+    "<enableBLOB device=\"Dev\">Also</enableBLOB>",
+    "<newNumberVector device=\"Dev\" name=\"numbers\"><oneNumber name=\"n1\">  12.5 </oneNumber><oneNumber name=\"n2\">\"7\"</oneNumber></newNumberVector>",
+    "<newSwitchVector device=\"Dev\" name=\"switches\">\n  <oneSwitch name=\"s1\">On</oneSwitch>\n  <oneSwitch name=\"s2\">Off</oneSwitch>\n</newSwitchVector>",
+    "<newTextVector device=\"Dev\" name=\"texts\"><oneText name=\"t1\">a &quot;b&quot; &apos;c&apos;</oneText></newTextVector>",
+    /* Text, comments and CDATA */
+    "<foo>first<bar />second</foo>",
+    "<foo><bar />first<!-- x -->second</foo>",
+    "<foo>  \"  \"  </foo>",
+    "<foo>a<![CDATA[&bad]]>b</foo>",
+    "<foo><!-- &bad --></foo>",
+    "<foo bar=\"1\" bar=\"2\"></foo>",
+    /* Invalid */
+    "",
+    "foo",
+    "<foo>",
+    "<foo></bar>",
+    "<foo><bar></foo>",
+    "<foo bar></foo>",
+    "<foo bar=baz></foo>",
+    "<foo bar=\"baz></foo>",
+    "<foo>&bad;</foo>",
+    "<foo>ok<bar />&bad;</foo>",
+    "<foo>ok<bar />&lt</foo>",
+    "<foo bar=\"&bad;\"></foo>",
+    "<foo><!-- unterminated</foo>",
+    "<foo><![CDATA[unterminated</foo>",
+    "<foo></foo><bar></bar>",
+    "<foo></foo>trailing",
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* nyx_object_to_xml_string() must be byte-identical to nyx_object_to_xmldoc() + nyx_xmldoc_to_string(). */
+
+static STR_t JSON_FIXTURES[] = {
+    "{\"<>\": \"foo\"}",
+    "{\"<>\": \"foo\", \"@bar\": \"a <&> \\\"b\\\" 'c'\", \"$\": \"x <&> \\\"y\\\" 'z'\"}",
+    "{\"<>\": \"foo\", \"@int\": 12, \"@float\": 1.5, \"@true\": true, \"@false\": false, \"@null\": null}",
+    "{\"<>\": \"foo\", \"$\": 42}",
+    "{\"<>\": \"foo\", \"children\": [{\"<>\": \"bar\", \"$\": \"1\"}, {\"<>\": \"baz\", \"children\": [{\"<>\": \"qux\"}]}]}",
+    "{\"<>\": \"foo\", \"$\": \"text\", \"children\": [{\"<>\": \"bar\"}]}",
+    "{\"<>\": \"foo\", \"children\": [{\"<>\": \"bar\"}], \"$\": \"text\"}",
+    "{\"<>\": \"foo\", \"ignored\": \"value\", \"@bar\": \"baz\"}",
+};
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool same_xml(const nyx_object_t *object)
+{
+    str_t xml = nyx_object_to_xml_string(object);
+
+    nyx_xmldoc_t *xmldoc = nyx_object_to_xmldoc(object);
+
+    str_t expected = xmldoc != NULL ? nyx_xmldoc_to_string(xmldoc) : NULL;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    bool result = (xml == NULL) == (expected == NULL) && (xml == NULL || strcmp(xml, expected) == 0);
+
+    if(result == false)
+    {
+        fprintf(stderr, "got: %s\nexpected: %s\n", xml != NULL ? xml : "(null)", expected != NULL ? expected : "(null)");
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_free(expected);
+
+    nyx_xmldoc_free(xmldoc);
+
+    nyx_memory_free(xml);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool same_result(size_t size, STR_t buff)
+{
+    nyx_object_t *object = nyx_xml_buff_to_object(size, buff);
+
+    nyx_xmldoc_t *xmldoc = nyx_xmldoc_parse_buff(size, buff);
+
+    nyx_object_t *expected = nyx_xmldoc_to_object(xmldoc);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    bool result = (object == NULL) == (expected == NULL);
+
+    if(result && object != NULL)
+    {
+        str_t json = nyx_object_to_string(object);
+        str_t expected_json = nyx_object_to_string(expected);
+
+        result = nyx_object_equal(object, expected) && strcmp(json, expected_json) == 0 && same_xml(object);
+
+        if(result == false)
+        {
+            fprintf(stderr, "got: %s\nexpected: %s\n", json, expected_json);
+        }
+
+        nyx_memory_free(expected_json);
+        nyx_memory_free(json);
+    }
+
+    if(result == false)
+    {
+        fprintf(stderr, "input: %.*s\n", (int) (size < 256 ? size : 256), buff);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_object_unref(expected);
+
+    nyx_xmldoc_free(xmldoc);
+
+    nyx_object_unref(object);
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_FATAL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(size_t i = 0; i < sizeof(FIXTURES) / sizeof(FIXTURES[0]); i++)
+    {
+        CHECK(same_result(strlen(FIXTURES[i]), FIXTURES[i]));
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK(same_xml(NULL));
+
+    for(size_t i = 0; i < sizeof(JSON_FIXTURES) / sizeof(JSON_FIXTURES[0]); i++)
+    {
+        nyx_object_t *object = nyx_object_parse(JSON_FIXTURES[i]);
+
+        CHECK(object != NULL);
+
+        bool same = same_xml(object);
+
+        nyx_object_unref(object);
+
+        CHECK(same);
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Truncated at every byte. */
+
+    STR_t message = FIXTURES[19];
+
+    for(size_t size = 1; size < strlen(message); size++)
+    {
+        CHECK(same_result(size, message));
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* Attribute names too long for the stack buffer. */
+
+    static char long_name[100000];
+
+    for(size_t len = 60; len <= 66; len++)
+    {
+        memset(long_name, 'a', sizeof(long_name));
+
+        memcpy(long_name, "<foo ", 5);
+
+        memcpy(long_name + 5 + len, "=\"x\" />", 8);
+
+        CHECK(same_result(strlen(long_name), long_name));
+    }
+
+    memset(long_name, 'a', sizeof(long_name));
+
+    memcpy(long_name, "<foo ", 5);
+
+    memcpy(long_name + sizeof(long_name) - 8, "=\"x\" />", 8);
+
+    CHECK(same_result(strlen(long_name), long_name));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
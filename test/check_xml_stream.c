@@ -0,0 +1,265 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node_internal.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#define MSG1 "<getProperties version=\"1.7\" />"
+#define MSG2 "<newNumberVector device=\"Dev\" name=\"numbers\"><oneNumber name=\"n1\">1</oneNumber></newNumberVector>"
+#define MSG3 "<enableBLOB device=\"Dev\">Also</enableBLOB>"
+#define MSG4 "<newTextVector device=\"Dev\" name=\"texts\"><oneText name=\"t1\">a &lt;/newText&gt; b</oneText></newTextVector>"
+#define MSG5 "<message device=\"Dev\" message=\"hi\"/>"
+#define MSG6 "<delProperty device=\"Dev\" name=\"numbers\"/>"
+#define MSG7 "<newSwitchVector\tdevice=\"Dev\" name=\"s\"><oneSwitch name=\"a\">On</oneSwitch></newSwitchVector>"
+
+#define TAIL "<newBLOBVec"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Messages pipelined and separated by garbage, including tags that are not INDI commands. */
+
+static STR_t STREAM = "garbage before " MSG1 "\r\n" MSG2 "<newNumberVectorX> <foo>not INDI</foo> < <getPropertiesjunk/>" MSG3 MSG4 MSG5 MSG6 "\n" MSG7 "trailing " TAIL;
+
+static STR_t EXPECTED = MSG1 "|" MSG2 "|" MSG3 "|" MSG4 "|" MSG5 "|" MSG6 "|" MSG7 "|";
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static STR_t STREAM2 = MSG7 MSG6 "<<<" MSG5 MSG4 "</newTextVector>" MSG3 MSG2 MSG1;
+
+static STR_t EXPECTED2 = MSG7 "|" MSG6 "|" MSG5 "|" MSG4 "|" MSG3 "|" MSG2 "|" MSG1 "|";
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/* Mimics the receive buffer of a connection: consumed bytes are removed from its front, as mg_iobuf_del() does. */
+
+typedef struct
+{
+    nyx_xml_stream_t xml_stream;
+
+    char recv[4096];
+    size_t recv_len;
+
+    char messages[4096];
+    size_t messages_len;
+
+    size_t consumed;
+
+} client_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void client_init(client_t *client)
+{
+    memset(client, 0, sizeof(client_t));
+
+    client->xml_stream = NYX_XML_STREAM();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool client_feed(client_t *client, size_t size, STR_t buff)
+{
+    nyx_xml_stream_t *xml_stream = &client->xml_stream;
+
+    if(client->recv_len + size > sizeof(client->recv))
+    {
+        return false;
+    }
+
+    memcpy(client->recv + client->recv_len, buff, size);
+
+    client->recv_len += size;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    while(nyx_xml_stream_next(xml_stream, client->recv_len, client->recv))
+    {
+        if(xml_stream->s_ptr < client->recv || xml_stream->s_ptr + xml_stream->len > client->recv + client->recv_len
+           ||
+           client->messages_len + xml_stream->len + 1 > sizeof(client->messages)
+        ) {
+            return false;
+        }
+
+        memcpy(client->messages + client->messages_len, xml_stream->s_ptr, xml_stream->len);
+
+        client->messages_len += xml_stream->len;
+
+        client->messages[client->messages_len++] = '|';
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t consumed = nyx_xml_stream_consume(xml_stream);
+
+    if(consumed > client->recv_len)
+    {
+        return false;
+    }
+
+    memmove(client->recv, client->recv + consumed, client->recv_len - consumed);
+
+    client->recv_len -= consumed;
+
+    client->consumed += consumed;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    /* The state must have been rebased onto the bytes kept. */
+
+    return xml_stream->done == 0
+           &&
+           xml_stream->scan <= client->recv_len
+           &&
+           (xml_stream->tag == NULL || xml_stream->pos <= xml_stream->scan)
+    ;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool client_check(const client_t *client, STR_t expected, STR_t stream, STR_t tail)
+{
+    size_t tail_len = strlen(tail);
+
+    bool result = client->messages_len == strlen(expected) && memcmp(client->messages, expected, client->messages_len) == 0
+                  &&
+                  client->recv_len == tail_len && memcmp(client->recv, tail, tail_len) == 0
+                  &&
+                  client->consumed + tail_len == strlen(stream)
+    ;
+
+    if(result == false)
+    {
+        fprintf(stderr, "messages: %.*s\nkept: %.*s\n", (int) client->messages_len, client->messages, (int) client->recv_len, client->recv);
+    }
+
+    return result;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static uint32_t random_chunk(uint32_t *seed)
+{
+    *seed = *seed * 1664525U + 1013904223U;
+
+    return 1U + (*seed >> 16) % 64U;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    nyx_memory_initialize();
+
+    nyx_set_log_level(NYX_LOG_LEVEL_FATAL);
+
+    client_t client1;
+    client_t client2;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* TRUNCATED OPENING TAG                                                                                          */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    client_init(&client1);
+
+    CHECK(client_feed(&client1, 17, "junk<newNumberVec"));
+
+    CHECK(client1.consumed == 4 && client1.recv_len == 13 && client1.xml_stream.tag == NULL && client1.xml_stream.scan == 0);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* OPENING TAG FOUND, CLOSING TAG SPLIT ACROSS READS                                                              */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    STR_t body = "tor device=\"Dev\" name=\"numbers\"><oneNumber name=\"n1\">1</oneNumber></newNumberVec";
+
+    CHECK(client_feed(&client1, strlen(body), body));
+
+    CHECK(client1.consumed == 4 && client1.messages_len == 0 && client1.xml_stream.tag != NULL && client1.xml_stream.pos == 0);
+
+    /* Only the bytes that may start the closing tag are scanned again. */
+
+    CHECK(client1.xml_stream.scan == client1.recv_len - (strlen("</newNumberVector>") - 1));
+
+    CHECK(client_feed(&client1, 10, "tor>xx<get"));
+
+    CHECK(client_check(&client1, MSG2 "|", "junk" MSG2 "xx<get", "<get"));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* GARBAGE BEFORE A MESSAGE STARTED IN THE SAME READ                                                              */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    client_init(&client1);
+
+    CHECK(client_feed(&client1, 29, "ab<enableBLOB device=\"Dev\">Al"));
+
+    CHECK(client1.consumed == 2 && client1.xml_stream.tag != NULL && client1.xml_stream.pos == 0);
+
+    CHECK(client_feed(&client1, 15, "so</enableBLOB>"));
+
+    CHECK(client_check(&client1, MSG3 "|", "ab" MSG3, ""));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* WHOLE STREAM IN ONE READ                                                                                       */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    client_init(&client1);
+
+    CHECK(client_feed(&client1, strlen(STREAM), STREAM));
+
+    CHECK(client_check(&client1, EXPECTED, STREAM, TAIL));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* BYTE BY BYTE                                                                                                   */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    client_init(&client1);
+
+    for(size_t i = 0; i < strlen(STREAM); i++)
+    {
+        CHECK(client_feed(&client1, 1, STREAM + i));
+    }
+
+    CHECK(client_check(&client1, EXPECTED, STREAM, TAIL));
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+    /* RANDOM CHUNKS, TWO CLIENTS INTERLEAVED                                                                         */
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    for(uint32_t seed = 1; seed <= 200; seed++)
+    {
+        client_init(&client1);
+        client_init(&client2);
+
+        size_t size1 = strlen(STREAM), off1 = 0;
+        size_t size2 = strlen(STREAM2), off2 = 0;
+
+        uint32_t state = seed;
+
+        while(off1 < size1 || off2 < size2)
+        {
+            size_t chunk1 = random_chunk(&state);
+            size_t chunk2 = random_chunk(&state);
+
+            if(chunk1 > size1 - off1) chunk1 = size1 - off1;
+            if(chunk2 > size2 - off2) chunk2 = size2 - off2;
+
+            CHECK(client_feed(&client1, chunk1, STREAM + off1));
+            CHECK(client_feed(&client2, chunk2, STREAM2 + off2));
+
+            off1 += chunk1;
+            off2 += chunk2;
+        }
+
+        CHECK(client_check(&client1, EXPECTED, STREAM, TAIL));
+        CHECK(client_check(&client2, EXPECTED2, STREAM2, ""));
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,173 @@
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+#include <string.h>
+
+#include "../src/nyx_node.h"
+#include "check.h"
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+typedef struct
+{
+    uint8_t buff[131072];
+
+    size_t size;
+
+} sink_ctx_t;
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static void sink(void *ctx, size_t size, BUFF_t buff)
+{
+    sink_ctx_t *sink_ctx = (sink_ctx_t *) ctx;
+
+    if(sink_ctx->size + size <= sizeof(sink_ctx->buff))
+    {
+        memcpy(sink_ctx->buff + sink_ctx->size, buff, size);
+    }
+
+    sink_ctx->size += size;
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool deflate_chunked(sink_ctx_t *result, bool base64, size_t chunk_size, size_t size, const uint8_t *buff)
+{
+    result->size = 0;
+
+    nyx_zlib_stream_t *stream = nyx_zlib_deflate_new(9, NYX_ZLIB_STRATEGY_DEFAULT, base64, sink, result);
+
+    if(stream == NULL)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < size; i += chunk_size)
+    {
+        if(!nyx_zlib_deflate_push(stream, i + chunk_size < size ? chunk_size : size - i, buff + i, false))
+        {
+            nyx_zlib_deflate_end(stream);
+
+            return false;
+        }
+    }
+
+    return nyx_zlib_deflate_end(stream) && result->size <= sizeof(result->buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+static bool inflate_chunked(sink_ctx_t *result, bool base64, size_t chunk_size, size_t size, const uint8_t *buff)
+{
+    result->size = 0;
+
+    nyx_zlib_stream_t *stream = nyx_zlib_inflate_new(base64, sink, result);
+
+    if(stream == NULL)
+    {
+        return false;
+    }
+
+    for(size_t i = 0; i < size; i += chunk_size)
+    {
+        if(!nyx_zlib_inflate_push(stream, i + chunk_size < size ? chunk_size : size - i, buff + i))
+        {
+            nyx_zlib_inflate_end(stream);
+
+            return false;
+        }
+    }
+
+    return nyx_zlib_inflate_end(stream) && result->size <= sizeof(result->buff);
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+int main(void)
+{
+    static uint8_t buff[50000];
+
+    static sink_ctx_t raw_ctx;
+    static sink_ctx_t b64_ctx;
+    static sink_ctx_t out_ctx;
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    nyx_memory_initialize();
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    uint32_t seed = 0x12345678;
+
+    for(size_t i = 0; i < sizeof(buff); i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+
+        buff[i] = (uint8_t) ((i / 64) % 7 == 0 ? (seed >> 16) : (i % 23));
+    }
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    size_t oneshot_size;
+
+    buff_t oneshot_buff = nyx_zlib_deflate(&oneshot_size, sizeof(buff), buff);
+
+    CHECK(oneshot_buff != NULL);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    static const size_t CHUNK_SIZES[] = {1, 2, 3, 7, 64, 1000, 4096, 65536};
+
+    for(size_t k = 0; k < sizeof(CHUNK_SIZES) / sizeof(CHUNK_SIZES[0]); k++)
+    {
+        size_t chunk_size = CHUNK_SIZES[k];
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* DEFLATE                                                                                                    */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        CHECK(deflate_chunked(&raw_ctx, false, chunk_size, sizeof(buff), buff));
+
+        CHECK(raw_ctx.size == oneshot_size && memcmp(raw_ctx.buff, oneshot_buff, oneshot_size) == 0);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* DEFLATE + BASE64                                                                                           */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        CHECK(deflate_chunked(&b64_ctx, true, chunk_size, sizeof(buff), buff));
+
+        size_t encoded_len;
+
+        str_t encoded_str = nyx_base64_encode(&encoded_len, oneshot_size, oneshot_buff);
+
+        CHECK(b64_ctx.size == encoded_len && memcmp(b64_ctx.buff, encoded_str, encoded_len) == 0);
+
+        nyx_memory_free(encoded_str);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* INFLATE                                                                                                    */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        CHECK(inflate_chunked(&out_ctx, false, chunk_size, raw_ctx.size, raw_ctx.buff));
+
+        CHECK(out_ctx.size == sizeof(buff) && memcmp(out_ctx.buff, buff, sizeof(buff)) == 0);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+        /* BASE64 + INFLATE                                                                                           */
+        /*------------------------------------------------------------------------------------------------------------*/
+
+        CHECK(inflate_chunked(&out_ctx, true, chunk_size, b64_ctx.size, b64_ctx.buff));
+
+        CHECK(out_ctx.size == sizeof(buff) && memcmp(out_ctx.buff, buff, sizeof(buff)) == 0);
+
+        /*------------------------------------------------------------------------------------------------------------*/
+    }
+
+    nyx_memory_free(oneshot_buff);
+
+    /*----------------------------------------------------------------------------------------------------------------*/
+
+    CHECK_EPILOGUE();
+}
+
+/*--------------------------------------------------------------------------------------------------------------------*/